@@ -0,0 +1,57 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_ALLOCATOR_S21_ALLOCATOR_PROPAGATION_H
+#define CPP2_S21_CONTAINERS_2_SRC_ALLOCATOR_S21_ALLOCATOR_PROPAGATION_H
+
+#include <memory>
+#include <utility>
+
+namespace s21 {
+
+// The propagate_on_container_* rules every allocator-aware container follows
+// when it is assigned or swapped.
+
+template <class Alloc>
+void propagateOnCopyAssign(Alloc &to, const Alloc &from) {
+  if constexpr (std::allocator_traits<
+                    Alloc>::propagate_on_container_copy_assignment::value) {
+    to = from;
+  }
+}
+
+template <class Alloc>
+void propagateOnMoveAssign(Alloc &to, Alloc &from) {
+  if constexpr (std::allocator_traits<
+                    Alloc>::propagate_on_container_move_assignment::value) {
+    to = std::move(from);
+  }
+}
+
+template <class Alloc>
+void propagateOnSwap(Alloc &a, Alloc &b) {
+  if constexpr (std::allocator_traits<
+                    Alloc>::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(a, b);
+  }
+}
+
+// True when memory from one allocator may be freed through the other.
+template <class Alloc>
+bool allocatorsEqual(const Alloc &a, const Alloc &b) {
+  if constexpr (std::allocator_traits<Alloc>::is_always_equal::value) {
+    return true;
+  } else {
+    return a == b;
+  }
+}
+
+// Whether a move assignment can take the other container's memory as is.
+template <class Alloc>
+bool canStealOnMoveAssign(const Alloc &to, const Alloc &from) {
+  return std::allocator_traits<
+             Alloc>::propagate_on_container_move_assignment::value ||
+         allocatorsEqual(to, from);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_ALLOCATOR_S21_ALLOCATOR_PROPAGATION_H
@@ -0,0 +1,226 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_ALLOCATOR_S21_POOL_ALLOCATOR_H
+#define CPP2_S21_CONTAINERS_2_SRC_ALLOCATOR_S21_POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace s21 {
+
+// Fixed-size blocks of Size bytes carved from 64 KiB slabs. Each thread keeps
+// its own free list and trades batches of kBatch blocks with a shared depot,
+// so the common allocate/deallocate is a pointer pop/push with no locking.
+// Slabs are never returned to the system; a block freed by another thread
+// simply joins that thread's free list.
+template <std::size_t Size, std::size_t Align>
+class SlabPool {
+ public:
+  static void *allocate() {
+    Cache &cache = local();
+    if (cache.head == nullptr) {
+      registerExit(cache);
+      refill(cache);
+    }
+    Block *block = cache.head;
+    cache.head = block->next;
+    --cache.count;
+    return block;
+  }
+
+  static void deallocate(void *ptr) noexcept {
+    Cache &cache = local();
+    registerExit(cache);
+    Block *block = static_cast<Block *>(ptr);
+    block->next = cache.head;
+    cache.head = block;
+    if (++cache.count >= cache.limit) drain(cache);
+  }
+
+ private:
+  // next links the blocks of a free list. The head of a chain parked in
+  // the depot also links the next chain and records its own length, so
+  // parking and taking chains never allocates.
+  struct Block {
+    Block *next;
+    Block *next_chain;
+    std::size_t count;
+  };
+
+  static constexpr std::size_t kAlign =
+      Align > alignof(Block) ? Align : alignof(Block);
+  static constexpr std::size_t kBlockSize =
+      ((Size > sizeof(Block) ? Size : sizeof(Block)) + kAlign - 1) / kAlign *
+      kAlign;
+  static constexpr std::size_t kSlabBytes = 64 * 1024;
+  static constexpr std::size_t kSlabBlocks =
+      kSlabBytes / kBlockSize > 16 ? kSlabBytes / kBlockSize : 16;
+  static constexpr std::size_t kBatch = 256;
+
+  // Constant-initialized and trivially destructible, so reaching it costs
+  // one TLS access. limit drops to 1 once the thread has started exiting.
+  struct Cache {
+    Block *head = nullptr;
+    std::size_t count = 0;
+    std::size_t limit = 2 * kBatch;
+    bool registered = false;
+  };
+
+  struct Depot {
+    std::mutex mutex;
+    Block *chains = nullptr;
+    std::vector<void *> slabs;
+  };
+
+  // Hands the blocks of an exiting thread back to the depot.
+  struct Releaser {
+    ~Releaser() {
+      Cache &cache = local();
+      cache.limit = 1;
+      if (cache.head != nullptr) drain(cache);
+    }
+  };
+
+  static Cache &local() noexcept {
+    thread_local Cache cache;
+    return cache;
+  }
+
+  // Never destroyed: containers with static storage may still free nodes
+  // after main() returns.
+  static Depot &depot() {
+    static Depot *depot = new Depot;
+    return *depot;
+  }
+
+  // Any thread that touches the pool, including one that only frees
+  // blocks allocated elsewhere, hands its free list back when it exits.
+  static void registerExit(Cache &cache) noexcept {
+    if (!cache.registered) {
+      cache.registered = true;
+      thread_local Releaser releaser;
+      static_cast<void>(releaser);
+    }
+  }
+
+  static void refill(Cache &cache) {
+    Depot &shared = depot();
+    {
+      std::lock_guard<std::mutex> lock(shared.mutex);
+      if (shared.chains != nullptr) {
+        Block *chain = shared.chains;
+        shared.chains = chain->next_chain;
+        cache.head = chain;
+        cache.count = chain->count;
+        return;
+      }
+    }
+    // The slab is cut into chains of kBatch blocks: the thread keeps the
+    // first one and the rest go to the depot.
+    char *slab = static_cast<char *>(
+        ::operator new(kSlabBlocks * kBlockSize, std::align_val_t(kAlign)));
+    Block *parked = nullptr;
+    for (std::size_t begin = 0; begin < kSlabBlocks; begin += kBatch) {
+      std::size_t end = begin + kBatch < kSlabBlocks ? begin + kBatch
+                                                     : kSlabBlocks;
+      Block *head = nullptr;
+      for (std::size_t i = end; i-- > begin;) {
+        Block *block = reinterpret_cast<Block *>(slab + i * kBlockSize);
+        block->next = head;
+        head = block;
+      }
+      if (begin == 0) {
+        cache.head = head;
+        cache.count = end - begin;
+      } else {
+        head->next_chain = parked;
+        head->count = end - begin;
+        parked = head;
+      }
+    }
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    try {
+      shared.slabs.push_back(slab);
+    } catch (...) {
+      cache.head = nullptr;
+      cache.count = 0;
+      ::operator delete(slab, std::align_val_t(kAlign));
+      throw;
+    }
+    while (parked != nullptr) {
+      Block *chain = parked;
+      parked = chain->next_chain;
+      park(shared, chain);
+    }
+  }
+
+  // Pushes a chain whose head records its length; shared.mutex is held.
+  static void park(Depot &shared, Block *chain) noexcept {
+    chain->next_chain = shared.chains;
+    shared.chains = chain;
+  }
+
+  // Moves kBatch blocks to the depot, or all of them once the thread exits.
+  static void drain(Cache &cache) noexcept {
+    std::size_t moved = cache.limit == 1 ? cache.count : kBatch;
+    Block *last = cache.head;
+    for (std::size_t i = 1; i < moved; ++i) last = last->next;
+    Block *chain = cache.head;
+    chain->count = moved;
+    cache.head = last->next;
+    cache.count -= moved;
+    last->next = nullptr;
+    Depot &shared = depot();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    park(shared, chain);
+  }
+};
+
+// Stateless allocator that serves single objects from SlabPool and anything
+// else from the global heap. Suits containers that allocate node by node;
+// s21::pooled_list is list with this allocator.
+template <typename T>
+class pool_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  pool_allocator() noexcept = default;
+  template <typename U>
+  pool_allocator(const pool_allocator<U> &) noexcept {}
+
+  T *allocate(size_type n) {
+    if (n == 1) return static_cast<T *>(pool::allocate());
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *ptr, size_type n) noexcept {
+    if (n == 1) {
+      pool::deallocate(ptr);
+    } else {
+      std::allocator<T>().deallocate(ptr, n);
+    }
+  }
+
+ private:
+  using pool = SlabPool<sizeof(T), alignof(T)>;
+};
+
+template <typename T, typename U>
+bool operator==(const pool_allocator<T> &, const pool_allocator<U> &) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const pool_allocator<T> &, const pool_allocator<U> &) {
+  return false;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_ALLOCATOR_S21_POOL_ALLOCATOR_H
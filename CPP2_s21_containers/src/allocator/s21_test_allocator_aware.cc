@@ -0,0 +1,274 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../list/s21_list.h"
+#include "../map/s21_map.h"
+#include "../multiset/s21_multiset.h"
+#include "../queue/s21_queue.h"
+#include "../set/s21_set.h"
+#include "../stack/s21_stack.h"
+#include "../vector/s21_vector.h"
+
+namespace {
+
+struct Arena {
+  std::size_t live = 0;
+  std::size_t allocations = 0;
+};
+
+// Stateful allocator that books everything it hands out against an arena;
+// two instances are equal only when they share one.
+template <typename T, bool Propagate = false>
+struct arena_allocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::bool_constant<Propagate>;
+  using propagate_on_container_move_assignment = std::bool_constant<Propagate>;
+  using propagate_on_container_swap = std::bool_constant<Propagate>;
+
+  template <typename U>
+  struct rebind {
+    using other = arena_allocator<U, Propagate>;
+  };
+
+  explicit arena_allocator(Arena *arena) : arena(arena) {}
+
+  template <typename U>
+  arena_allocator(const arena_allocator<U, Propagate> &other)
+      : arena(other.arena) {}
+
+  T *allocate(std::size_t n) {
+    arena->live += n;
+    ++arena->allocations;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *ptr, std::size_t n) {
+    arena->live -= n;
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  Arena *arena;
+};
+
+template <typename T, typename U, bool P>
+bool operator==(const arena_allocator<T, P> &a,
+                const arena_allocator<U, P> &b) {
+  return a.arena == b.arena;
+}
+
+template <typename T, typename U, bool P>
+bool operator!=(const arena_allocator<T, P> &a,
+                const arena_allocator<U, P> &b) {
+  return a.arena != b.arena;
+}
+
+}  // namespace
+
+TEST(AllocatorAware, VectorAllocatesFromItsArena) {
+  Arena arena;
+  {
+    s21::vector<int, arena_allocator<int>> v({1, 2, 3},
+                                             arena_allocator<int>(&arena));
+    v.push_back(4);
+    EXPECT_EQ(v.get_allocator().arena, &arena);
+    EXPECT_EQ(arena.live, v.capacity());
+    EXPECT_EQ(v[3], 4);
+  }
+  EXPECT_EQ(arena.live, 0U);
+}
+
+TEST(AllocatorAware, VectorMoveAssignMovesElementsBetweenArenas) {
+  Arena a, b;
+  using alloc = arena_allocator<int>;
+  s21::vector<int, alloc> source({1, 2, 3}, alloc(&a));
+  s21::vector<int, alloc> target({9}, alloc(&b));
+  const int *old_data = source.data();
+  target = std::move(source);
+  EXPECT_EQ(target.get_allocator().arena, &b);
+  EXPECT_NE(target.data(), old_data);
+  ASSERT_EQ(target.size(), 3U);
+  EXPECT_EQ(target[2], 3);
+  EXPECT_EQ(b.live, target.capacity());
+}
+
+TEST(AllocatorAware, VectorMoveAssignStealsWhenPropagating) {
+  Arena a, b;
+  using alloc = arena_allocator<int, true>;
+  s21::vector<int, alloc> source({1, 2, 3}, alloc(&a));
+  s21::vector<int, alloc> target({9}, alloc(&b));
+  const int *old_data = source.data();
+  target = std::move(source);
+  EXPECT_EQ(target.get_allocator().arena, &a);
+  EXPECT_EQ(target.data(), old_data);
+  EXPECT_EQ(b.live, 0U);
+}
+
+TEST(AllocatorAware, VectorCopyAndSwapFollowTraits) {
+  Arena a, b;
+  using alloc = arena_allocator<int, true>;
+  s21::vector<int, alloc> first({1, 2}, alloc(&a));
+  s21::vector<int, alloc> copy(first);
+  EXPECT_EQ(copy.get_allocator().arena, &a);
+  s21::vector<int, alloc> second({3}, alloc(&b));
+  first.swap(second);
+  EXPECT_EQ(first.get_allocator().arena, &b);
+  EXPECT_EQ(second.get_allocator().arena, &a);
+  EXPECT_EQ(first[0], 3);
+  second = first;
+  EXPECT_EQ(second.get_allocator().arena, &b);
+  EXPECT_EQ(a.live, copy.capacity());
+}
+
+TEST(AllocatorAware, ListNodesComeFromTheArena) {
+  Arena a, b;
+  using alloc = arena_allocator<int>;
+  {
+    s21::list<int, alloc> source({1, 2, 3}, alloc(&a));
+    EXPECT_EQ(a.live, 3U);
+    s21::list<int, alloc> target{alloc(&b)};
+    target = std::move(source);
+    EXPECT_EQ(target.get_allocator().arena, &b);
+    EXPECT_EQ(b.live, 3U);
+    EXPECT_EQ(target.back(), 3);
+  }
+  EXPECT_EQ(a.live, 0U);
+  EXPECT_EQ(b.live, 0U);
+}
+
+TEST(AllocatorAware, ListSwapExchangesNodesAndAllocators) {
+  Arena a, b;
+  {
+    using alloc = arena_allocator<int, true>;
+    s21::list<int, alloc> first({1, 2, 3}, alloc(&a));
+    s21::list<int, alloc> second({4}, alloc(&b));
+    first.swap(second);
+    EXPECT_EQ(first.get_allocator().arena, &b);
+    EXPECT_EQ(second.get_allocator().arena, &a);
+    EXPECT_EQ(first.size(), 1U);
+    EXPECT_EQ(second.back(), 3);
+    second.push_back(5);
+    EXPECT_EQ(a.live, 4U);
+    EXPECT_EQ(b.live, 1U);
+
+    using shared = arena_allocator<int>;
+    s21::list<int, shared> left({7, 8}, shared(&a));
+    s21::list<int, shared> right{shared(&a)};
+    left.swap(right);
+    EXPECT_TRUE(left.empty());
+    EXPECT_EQ(right.front(), 7);
+  }
+  EXPECT_EQ(a.live, 0U);
+  EXPECT_EQ(b.live, 0U);
+}
+
+TEST(AllocatorAware, MapAndSetNodesComeFromTheArena) {
+  Arena arena;
+  {
+    using pair_alloc = arena_allocator<std::pair<const int, int>>;
+    s21::map<int, int, s21::plain_lookup, pair_alloc> m{pair_alloc(&arena)};
+    m.insert(1, 10);
+    m.insert(2, 20);
+    m[3] = 30;
+    EXPECT_EQ(arena.live, 3U);
+    EXPECT_EQ(m.get_allocator().arena, &arena);
+    m.erase(m.begin());
+    EXPECT_EQ(arena.live, 2U);
+
+    s21::set<int, s21::plain_lookup, arena_allocator<int>> s(
+        {5, 6, 7}, arena_allocator<int>(&arena));
+    EXPECT_EQ(arena.live, 5U);
+    auto copy = s;
+    EXPECT_EQ(arena.live, 8U);
+    EXPECT_TRUE(copy.contains(6));
+  }
+  EXPECT_EQ(arena.live, 0U);
+}
+
+TEST(AllocatorAware, TreeMoveAssignReleasesOldNodes) {
+  Arena a, b;
+  using alloc = arena_allocator<int>;
+  s21::set<int, s21::plain_lookup, alloc> source({1, 2}, alloc(&a));
+  s21::set<int, s21::plain_lookup, alloc> target({7, 8, 9}, alloc(&b));
+  target = std::move(source);
+  EXPECT_EQ(target.size(), 2U);
+  EXPECT_EQ(target.get_allocator().arena, &b);
+  EXPECT_EQ(b.live, 2U);
+  EXPECT_EQ(a.live, 0U);
+}
+
+TEST(AllocatorAware, TreeMoveAssignMovesValuesBetweenArenas) {
+  Arena a, b;
+  using pair_alloc = arena_allocator<std::pair<const int, std::string>>;
+  using string_map =
+      s21::map<int, std::string, s21::plain_lookup, pair_alloc>;
+  {
+    string_map source{pair_alloc(&a)};
+    for (int i = 0; i < 5; ++i) source[i] = std::string(40, 'a' + i);
+    const char *buffer = source.at(3).data();
+    string_map target{pair_alloc(&b)};
+    target = std::move(source);
+    EXPECT_EQ(target.get_allocator().arena, &b);
+    EXPECT_EQ(target.at(3).data(), buffer);
+    EXPECT_EQ(target.at(4), std::string(40, 'e'));
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(a.live, 0U);
+    EXPECT_EQ(b.live, 5U);
+
+    s21::multiset<int, arena_allocator<int>> ms({1, 1, 2},
+                                                 arena_allocator<int>(&a));
+    s21::multiset<int, arena_allocator<int>> other{arena_allocator<int>(&b)};
+    other = std::move(ms);
+    EXPECT_EQ(other.size(), 3U);
+    EXPECT_EQ(a.live, 0U);
+  }
+  EXPECT_EQ(b.live, 0U);
+}
+
+TEST(AllocatorAware, TreeMoveAssignIsNoexceptWhenItCanSteal) {
+  using unequal = arena_allocator<int>;
+  using propagating = arena_allocator<int, true>;
+  EXPECT_TRUE(std::is_nothrow_move_assignable_v<s21::set<int>>);
+  EXPECT_TRUE((std::is_nothrow_move_assignable_v<s21::map<int, int>>));
+  EXPECT_TRUE(std::is_nothrow_move_assignable_v<s21::multiset<int>>);
+  EXPECT_TRUE((std::is_nothrow_move_assignable_v<
+               s21::set<int, s21::plain_lookup, propagating>>));
+  EXPECT_FALSE((std::is_nothrow_move_assignable_v<
+                s21::set<int, s21::plain_lookup, unequal>>));
+  EXPECT_FALSE(
+      (std::is_nothrow_move_assignable_v<s21::multiset<int, unequal>>));
+}
+
+TEST(AllocatorAware, MultisetNodesComeFromTheArena) {
+  Arena arena;
+  {
+    s21::multiset<int, arena_allocator<int>> ms(
+        {1, 1, 2}, arena_allocator<int>(&arena));
+    EXPECT_EQ(ms.size(), 3U);
+    EXPECT_EQ(arena.live, 2U);
+    EXPECT_EQ(ms.get_allocator().arena, &arena);
+  }
+  EXPECT_EQ(arena.live, 0U);
+}
+
+TEST(AllocatorAware, AdaptorsForwardTheAllocator) {
+  Arena arena;
+  using alloc = arena_allocator<int>;
+  {
+    s21::queue<int, s21::list<int, alloc>> q{alloc(&arena)};
+    q.push(1);
+    q.push(2);
+    s21::stack<int, s21::list<int, alloc>> st{alloc(&arena)};
+    st.push(3);
+    EXPECT_EQ(q.front(), 1);
+    EXPECT_EQ(st.top(), 3);
+    EXPECT_GE(arena.allocations, 3U);
+  }
+  EXPECT_EQ(arena.live, 0U);
+  EXPECT_FALSE(
+      (std::is_constructible_v<s21::queue<int>, arena_allocator<int>>));
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "s21_pool_allocator.h"
+
+namespace {
+
+struct alignas(32) Wide {
+  char bytes[40];
+};
+
+struct Record {
+  char bytes[72];
+};
+
+// Used by one test only, so its pool starts empty there.
+struct Message {
+  char bytes[136];
+};
+
+}  // namespace
+
+TEST(PoolAllocator, ReusesFreedBlock) {
+  s21::pool_allocator<Record> alloc;
+  Record *first = alloc.allocate(1);
+  alloc.deallocate(first, 1);
+  Record *second = alloc.allocate(1);
+  EXPECT_EQ(first, second);
+  alloc.deallocate(second, 1);
+}
+
+TEST(PoolAllocator, BlocksAreDistinctAndAligned) {
+  s21::pool_allocator<Wide> alloc;
+  std::vector<Wide *> blocks;
+  std::set<Wide *> unique;
+  for (int i = 0; i < 5000; ++i) {
+    Wide *block = alloc.allocate(1);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignof(Wide), 0U);
+    block->bytes[0] = static_cast<char>(i);
+    blocks.push_back(block);
+    unique.insert(block);
+  }
+  EXPECT_EQ(unique.size(), blocks.size());
+  for (int i = 0; i < 5000; ++i) {
+    EXPECT_EQ(blocks[i]->bytes[0], static_cast<char>(i));
+  }
+  for (Wide *block : blocks) alloc.deallocate(block, 1);
+}
+
+TEST(PoolAllocator, ArraysComeFromTheHeap) {
+  s21::pool_allocator<int> alloc;
+  int *array = alloc.allocate(100);
+  for (int i = 0; i < 100; ++i) array[i] = i;
+  EXPECT_EQ(array[99], 99);
+  alloc.deallocate(array, 100);
+}
+
+TEST(PoolAllocator, RebindsAndComparesEqual) {
+  s21::pool_allocator<int> ints;
+  s21::pool_allocator<double> doubles(ints);
+  EXPECT_TRUE(ints == doubles);
+  EXPECT_FALSE(ints != doubles);
+}
+
+TEST(PoolAllocator, FreesAcrossThreads) {
+  s21::pool_allocator<long> alloc;
+  std::vector<long *> blocks(3000);
+  std::thread producer([&] {
+    for (auto &block : blocks) *(block = alloc.allocate(1)) = 7;
+  });
+  producer.join();
+  for (long *block : blocks) {
+    EXPECT_EQ(*block, 7);
+    alloc.deallocate(block, 1);
+  }
+  std::thread consumer([&] {
+    for (auto &block : blocks) block = alloc.allocate(1);
+    for (long *block : blocks) alloc.deallocate(block, 1);
+  });
+  consumer.join();
+}
+
+TEST(PoolAllocator, ThreadThatOnlyFreesReturnsItsBlocks) {
+  s21::pool_allocator<Message> alloc;
+  std::vector<Message *> blocks(100);
+  std::thread producer([&] {
+    for (auto &block : blocks) block = alloc.allocate(1);
+  });
+  producer.join();
+  // Fewer blocks than a batch: they only leave the consumer at thread exit.
+  std::thread consumer([&] {
+    for (Message *block : blocks) alloc.deallocate(block, 1);
+  });
+  consumer.join();
+  std::set<Message *> freed(blocks.begin(), blocks.end());
+  std::thread reader([&] {
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+      blocks[i] = alloc.allocate(1);
+      EXPECT_EQ(freed.count(blocks[i]), 1U);
+    }
+    for (Message *block : blocks) alloc.deallocate(block, 1);
+  });
+  reader.join();
+}
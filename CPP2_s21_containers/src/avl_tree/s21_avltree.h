@@ -2,10 +2,18 @@
 #define CPP_2_S21_CONTAINERS_2_SRC_AVL_TREE_S21_AVLTREE_H
 
 #include <iostream>
+#include <memory>
+#include <utility>
+
+#include "../allocator/s21_allocator_propagation.h"
+#include "s21_tree_lookup.h"
 
 namespace s21 {
 
-template <typename Key, typename Value>
+// Nodes come from Allocator rebound to Node; Allocator's own value_type is
+// whatever the derived container exposes.
+template <typename Key, typename Value, typename Lookup = plain_lookup,
+          typename Allocator = std::allocator<Value>>
 class AVLTree {
  protected:
   struct Node;
@@ -21,6 +29,7 @@ class AVLTree {
   using iterator = Iterator;
   using const_iterator = ConstIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   class Iterator {
    public:
@@ -29,7 +38,7 @@ class AVLTree {
     Iterator(Node *node, Node *past_node = nullptr)
         : node_(node), past_node_(past_node){};
 
-    Node *moveBack(Node *node) {
+    static Node *moveBack(Node *node) {
       if (node->left != nullptr) {
         return getMax(node->left);
       }
@@ -43,6 +52,7 @@ class AVLTree {
 
     iterator &operator++() {
       if (node_ != nullptr) {
+        past_node_ = node_;
         if (node_->right != nullptr) {
           node_ = node_->right;
           while (node_->left != nullptr) {
@@ -61,38 +71,44 @@ class AVLTree {
       return *this;
     }
 
-    iterator &operator++(int) {
-      static iterator temp = *this;
+    iterator operator++(int) {
+      iterator temp = *this;
       operator++();
       return temp;
     }
 
     iterator &operator--() {
       if (node_ == nullptr && past_node_ != nullptr) {
-        *this = past_node_;
+        node_ = past_node_;
         return *this;
       }
       node_ = moveBack(node_);
       return *this;
     }
 
-    iterator &operator--(int) {
-      static iterator temp = *this;
+    iterator operator--(int) {
+      iterator temp = *this;
       operator--();
       return temp;
     }
 
-    reference operator*() {
+    // Dereferencing end() yields a value-initialized constant rather than a
+    // writable shared object, so readers on different threads never race.
+    const_reference operator*() const {
       if (node_ == nullptr) {
-        static Value fake = Value{};
+        static const Value fake = Value{};
         return fake;
       }
       return node_->value;
     }
 
-    bool operator==(const Iterator &other) { return node_ == other.node_; }
+    bool operator==(const Iterator &other) const {
+      return node_ == other.node_;
+    }
 
-    bool operator!=(const Iterator &other) { return node_ != other.node_; }
+    bool operator!=(const Iterator &other) const {
+      return node_ != other.node_;
+    }
 
    protected:
     Node *node_;
@@ -102,14 +118,28 @@ class AVLTree {
   class ConstIterator : public Iterator {
    public:
     ConstIterator() : Iterator(){};
-    const_reference operator*() const { return Iterator::operator*(); }
+    ConstIterator(Node *node, Node *past_node = nullptr)
+        : Iterator(node, past_node){};
+    ConstIterator(const Iterator &other) : Iterator(other){};
   };
 
   AVLTree() : root_(nullptr), inserted(false) {}
 
-  AVLTree(const AVLTree &other) { root_ = copyTree(other.root_); }
+  explicit AVLTree(const Allocator &alloc)
+      : root_(nullptr), inserted(false), alloc_(alloc) {}
+
+  AVLTree(const AVLTree &other)
+      : root_(nullptr),
+        inserted(false),
+        alloc_(node_traits::select_on_container_copy_construction(
+            other.alloc_)) {
+    root_ = copyTree(other.root_, nullptr);
+  }
 
-  AVLTree(AVLTree &&other) {
+  AVLTree(AVLTree &&other)
+      : inserted(false),
+        lookup_(std::move(other.lookup_)),
+        alloc_(std::move(other.alloc_)) {
     root_ = other.root_;
     other.root_ = nullptr;
   }
@@ -119,6 +149,8 @@ class AVLTree {
     root_ = nullptr;
   }
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
   void insert(const Key &key, const Value &value) {
     root_ = recursiveInsert(root_, key, value);
   }
@@ -132,47 +164,87 @@ class AVLTree {
     Node *right;
     Node *parent;
 
-    Node(Key &key, Value &value)
+    Node(const Key &key, const Value &value)
         : key(key),
           value(value),
           height(1),
           left(nullptr),
           right(nullptr),
           parent(nullptr) {}
+
+    Node(const Key &key, Value &&value)
+        : key(key),
+          value(std::move(value)),
+          height(1),
+          left(nullptr),
+          right(nullptr),
+          parent(nullptr) {}
   };
 
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
   Node *root_;
   bool inserted;
+  typename Lookup::template cache<Node, Key> lookup_;
+  node_allocator alloc_;
 
   AVLTree &operator=(const AVLTree &other) {
     if (this != &other) {
-      AVLTree temp(other);
-      recursiveClear(root_);
-      *this = std::move(temp);
+      clearTree();
+      propagateOnCopyAssign(alloc_, other.alloc_);
+      root_ = copyTree(other.root_, nullptr);
     }
     return *this;
   }
 
-  AVLTree &operator=(AVLTree &&other) {
+  // Takes other's nodes when the allocators allow it, else moves the
+  // elements one by one into nodes of its own.
+  AVLTree &operator=(AVLTree &&other) noexcept(
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value) {
     if (this != &other) {
-      root_ = other.root_;
-      other.root_ = nullptr;
+      clearTree();
+      if (canStealOnMoveAssign(alloc_, other.alloc_)) {
+        propagateOnMoveAssign(alloc_, other.alloc_);
+        root_ = std::exchange(other.root_, nullptr);
+        lookup_ = std::move(other.lookup_);
+      } else {
+        root_ = moveTree(other.root_, nullptr);
+      }
+      other.clearTree();
     }
     return *this;
   }
 
-  int getHeight(Node *node) { return node == nullptr ? 0 : node->height; }
+  template <typename V>
+  Node *createNode(const Key &key, V &&value) {
+    Node *node = node_traits::allocate(alloc_, 1);
+    try {
+      node_traits::construct(alloc_, node, key, std::forward<V>(value));
+    } catch (...) {
+      node_traits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroyNode(Node *node) {
+    node_traits::destroy(alloc_, node);
+    node_traits::deallocate(alloc_, node, 1);
+  }
+
+  int getHeight(Node *node) const { return node == nullptr ? 0 : node->height; }
 
   void updateHeight(Node *node) {
     if (node) {
       node->height =
           std::max(getHeight(node->left), getHeight(node->right)) + 1;
-      updateHeight(node->left);
-      updateHeight(node->right);
     }
   }
 
-  int getBalance(Node *node) {
+  int getBalance(Node *node) const {
     return node == nullptr ? 0 : getHeight(node->left) - getHeight(node->right);
   }
 
@@ -207,17 +279,15 @@ class AVLTree {
   Node *balance(Node *node) {
     int getBal = getBalance(node);
     if (getBal > 1) {
-      if (getBalance(node->right) != -1) {
-        node = rightRotation(node);
-      } else {
-        node = leftRotation(node);
+      if (getBalance(node->left) < 0) {
+        node->left = leftRotation(node->left);
       }
+      node = rightRotation(node);
     } else if (getBal < -1) {
-      if (getBalance(node->left) != 1) {
-        node = leftRotation(node);
-      } else {
-        node = rightRotation(node);
+      if (getBalance(node->right) > 0) {
+        node->right = rightRotation(node->right);
       }
+      node = leftRotation(node);
     }
     return node;
   }
@@ -233,10 +303,10 @@ class AVLTree {
     return getMin(node->left);
   }
 
-  Node *recursiveInsert(Node *node, Key key, Value value) {
+  Node *recursiveInsert(Node *node, const Key &key, const Value &value) {
     this->inserted = false;
     if (node == nullptr) {
-      Node *temp = new Node(key, value);
+      Node *temp = createNode(key, value);
       this->inserted = true;
       return temp;
     }
@@ -266,10 +336,12 @@ class AVLTree {
         Node *dupl_node = node;
         node = (node->left == nullptr) ? node->right : node->left;
         if (node != nullptr) node->parent = node_parent;
-        delete dupl_node;
+        lookup_.forget(dupl_node->key);
+        destroyNode(dupl_node);
 
       } else {
         Node *maxInLeft = getMax(node->left);
+        lookup_.forget(node->key);
         node->key = maxInLeft->key;
         node->value = maxInLeft->value;
         node->left = recursiveClearNode(node->left, maxInLeft->key);
@@ -282,33 +354,64 @@ class AVLTree {
     return node;
   }
 
-  Node *recursiveFind(Node *node, Key key) {
+  Node *findNode(const Key &key) const {
+    return lookup_.find(key,
+                        [this, &key] { return recursiveFind(root_, key); });
+  }
+
+  Node *recursiveFind(Node *node, const Key &key) const {
     if (node == nullptr) return nullptr;
     if (node->key == key) return node;
     return (key < node->key) ? recursiveFind(node->left, key)
                              : recursiveFind(node->right, key);
   }
 
+  void clearTree() {
+    if (root_ != nullptr) recursiveClear(root_);
+    root_ = nullptr;
+    lookup_.reset();
+  }
+
+  void swapTree(AVLTree &other) {
+    propagateOnSwap(alloc_, other.alloc_);
+    std::swap(root_, other.root_);
+    lookup_.reset();
+    other.lookup_.reset();
+  }
+
   void recursiveClear(Node *node) {
     if (node == nullptr) return;
     if (node->left != nullptr) recursiveClear(node->left);
     if (node->right != nullptr) recursiveClear(node->right);
-    delete node;
+    destroyNode(node);
   }
 
-  size_type recursiveSize(Node *node) {
+  size_type recursiveSize(Node *node) const {
     if (node == nullptr) return 0;
     size_type left_size = recursiveSize(node->left);
     size_type right_size = recursiveSize(node->right);
     return 1 + left_size + right_size;
   }
 
-  Node *copyTree(Node *node) {
+  Node *copyTree(Node *node, Node *parent) {
+    if (node == nullptr) return nullptr;
+    Node *new_node = createNode(node->key, node->value);
+    new_node->height = node->height;
+    new_node->parent = parent;
+    new_node->left = copyTree(node->left, new_node);
+    new_node->right = copyTree(node->right, new_node);
+    return new_node;
+  }
+
+  // Like copyTree, but moves the values out. Keys are copied, so node's
+  // tree stays ordered if a move throws.
+  Node *moveTree(Node *node, Node *parent) {
     if (node == nullptr) return nullptr;
-    Node *new_node = new Node(node->key, node->value);
-    new_node->left = copyTree(node->left);
-    new_node->right = copyTree(node->right);
-    new_node->parent = node->parent;
+    Node *new_node = createNode(node->key, std::move(node->value));
+    new_node->height = node->height;
+    new_node->parent = parent;
+    new_node->left = moveTree(node->left, new_node);
+    new_node->right = moveTree(node->right, new_node);
     return new_node;
   }
 };
@@ -0,0 +1,130 @@
+#ifndef CPP_2_S21_CONTAINERS_2_SRC_AVL_TREE_S21_TREE_LOOKUP_H
+#define CPP_2_S21_CONTAINERS_2_SRC_AVL_TREE_S21_TREE_LOOKUP_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace s21 {
+
+// Lookup policies for AVLTree. A policy provides cache<Node, Key>, which
+// sits in front of the tree descent: find() answers from the cache or falls
+// back to the descent it is handed, forget() runs before a node holding the
+// key is freed and reset() whenever the tree is dropped or replaced.
+
+// Every lookup descends from the root.
+struct plain_lookup {
+  template <typename Node, typename Key>
+  class cache {
+   public:
+    template <typename Descend>
+    Node *find(const Key &, Descend descend) const {
+      return descend();
+    }
+
+    void forget(const Key &) {}
+    void reset() {}
+  };
+};
+
+// Remembers the last node found for each of Slots hash buckets, so the hot
+// keys of a skewed workload are answered without walking the tree. A cold
+// miss overwrites its bucket; hot keys win their buckets back right away.
+// The slots are atomic because const lookups refill them: several threads
+// may read one tree as long as nobody modifies it at the same time.
+template <std::size_t Slots = 16384>
+struct hot_key_cache {
+  static_assert(Slots != 0 && (Slots & (Slots - 1)) == 0,
+                "hot_key_cache needs a power of two number of slots");
+
+  template <typename Node, typename Key>
+  class cache {
+   public:
+    cache() = default;
+
+    // Cached nodes belong to the source tree, so a copy starts out cold.
+    cache(const cache &) {}
+
+    // A moved tree keeps its nodes, so the slots go along with them.
+    cache(cache &&other) noexcept : slots_(other.release()) {}
+
+    ~cache() { delete[] slots_.load(std::memory_order_relaxed); }
+
+    cache &operator=(const cache &) {
+      reset();
+      return *this;
+    }
+
+    cache &operator=(cache &&other) noexcept {
+      if (this != &other) delete[] slots_.exchange(other.release());
+      return *this;
+    }
+
+    template <typename Descend>
+    Node *find(const Key &key, Descend descend) const {
+      std::atomic<Node *> *slots = slots_.load(std::memory_order_acquire);
+      Node *node = nullptr;
+      if (slots != nullptr) {
+        node = slots[index(key)].load(std::memory_order_relaxed);
+        if (node != nullptr && node->key == key) return node;
+      }
+      node = descend();
+      if (node != nullptr) {
+        table()[index(key)].store(node, std::memory_order_relaxed);
+      }
+      return node;
+    }
+
+    void forget(const Key &key) {
+      std::atomic<Node *> *slots = slots_.load(std::memory_order_relaxed);
+      if (slots != nullptr) {
+        slots[index(key)].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    void reset() {
+      std::atomic<Node *> *slots = slots_.load(std::memory_order_relaxed);
+      if (slots == nullptr) return;
+      for (std::size_t i = 0; i < Slots; ++i) {
+        slots[i].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+   private:
+    static std::size_t index(const Key &key) {
+      std::uint64_t hash = static_cast<std::uint64_t>(std::hash<Key>{}(key));
+      return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ULL) >> 32) &
+             (Slots - 1);
+    }
+
+    // The slots, allocated once a lookup first finds a node, so that empty,
+    // temporary and moved-from trees cost one pointer. Readers racing to
+    // allocate keep whichever table was published first.
+    std::atomic<Node *> *table() const {
+      std::atomic<Node *> *slots = slots_.load(std::memory_order_acquire);
+      if (slots != nullptr) return slots;
+      std::atomic<Node *> *fresh = new std::atomic<Node *>[Slots];
+      for (std::size_t i = 0; i < Slots; ++i) {
+        fresh[i].store(nullptr, std::memory_order_relaxed);
+      }
+      if (slots_.compare_exchange_strong(slots, fresh,
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+        return fresh;
+      }
+      delete[] fresh;
+      return slots;
+    }
+
+    std::atomic<Node *> *release() {
+      return slots_.exchange(nullptr, std::memory_order_relaxed);
+    }
+
+    mutable std::atomic<std::atomic<Node *> *> slots_{nullptr};
+  };
+};
+
+}  // namespace s21
+
+#endif  // CPP_2_S21_CONTAINERS_2_SRC_AVL_TREE_S21_TREE_LOOKUP_H
@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../map/s21_map.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+const int kKeys = 1 << 20;
+const int kLookups = 4000000;
+const int kHotKeys = 4000;
+
+// Keys are spread out and shuffled, so a popular rank is not also a
+// neighbour of the other popular ranks in the tree.
+std::vector<int> shuffledKeys() {
+  std::vector<int> keys(kKeys);
+  for (int i = 0; i < kKeys; ++i) keys[i] = i * 7;
+  s21::bench::Random random(42);
+  for (int i = kKeys - 1; i > 0; --i) {
+    std::swap(keys[i], keys[random.below(i + 1)]);
+  }
+  return keys;
+}
+
+std::vector<int> uniformQueries(const std::vector<int> &keys) {
+  s21::bench::Random random(7);
+  std::vector<int> queries(kLookups);
+  for (int &query : queries) query = keys[random.below(kKeys)];
+  return queries;
+}
+
+std::vector<int> zipfQueries(const std::vector<int> &keys, double skew) {
+  std::vector<double> cdf(kKeys);
+  double total = 0;
+  for (int rank = 0; rank < kKeys; ++rank) {
+    total += 1.0 / std::pow(rank + 1.0, skew);
+    cdf[rank] = total;
+  }
+  s21::bench::Random random(11);
+  std::vector<int> queries(kLookups);
+  for (int &query : queries) {
+    double point = total * (random.next() >> 11) * (1.0 / (1ULL << 53));
+    auto rank = std::upper_bound(cdf.begin(), cdf.end(), point) - cdf.begin();
+    query = keys[std::min<long>(rank, kKeys - 1)];
+  }
+  return queries;
+}
+
+// 90% of the lookups go to a few thousand hot keys, the rest are uniform.
+std::vector<int> hotSetQueries(const std::vector<int> &keys) {
+  s21::bench::Random random(13);
+  std::vector<int> queries(kLookups);
+  for (int &query : queries) {
+    bool hot = random.below(10) != 0;
+    query = keys[random.below(hot ? kHotKeys : kKeys)];
+  }
+  return queries;
+}
+
+template <typename Map>
+void run(const char *name, const Map &map, const std::vector<int> &queries) {
+  long sum = 0;
+  s21::bench::Stopwatch watch;
+  for (int key : queries) sum += map.at(key);
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(sum);
+  s21::bench::printRow(name, seconds, queries.size());
+}
+
+}  // namespace
+
+int main() {
+  std::vector<int> keys = shuffledKeys();
+  s21::map<int, int> plain;
+  s21::adaptive_map<int, int> adaptive;
+  for (int key : keys) {
+    plain.insert(key, key);
+    adaptive.insert(key, key);
+  }
+
+  struct Workload {
+    const char *title;
+    std::vector<int> queries;
+  };
+  Workload workloads[] = {
+      {"uniform lookups, 1M keys", uniformQueries(keys)},
+      {"Zipf(0.99) lookups, 1M keys", zipfQueries(keys, 0.99)},
+      {"90% on 4000 hot keys, 1M keys", hotSetQueries(keys)},
+  };
+  for (const auto &workload : workloads) {
+    s21::bench::printHeader(workload.title);
+    run("s21::map (AVL descent)", plain, workload.queries);
+    run("s21::adaptive_map (hot key cache)", adaptive, workload.queries);
+  }
+  return 0;
+}
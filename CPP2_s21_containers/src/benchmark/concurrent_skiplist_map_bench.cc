@@ -0,0 +1,93 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../concurrent_skiplist_map/s21_concurrent_skiplist_map.h"
+#include "../map/s21_map.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+const int kKeyRange = 40000;
+const int kOpsPerThread = 20000;
+
+// s21::map only erases through an iterator, so go to the tree directly.
+class BaselineMap : public s21::map<int, int> {
+ public:
+  void eraseKey(int key) { root_ = recursiveClearNode(root_, key); }
+};
+
+// s21::map behind a single mutex: the baseline for shared ordered access.
+class LockedMap {
+ public:
+  bool contains(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+
+  void insert(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert(key, value);
+  }
+
+  void erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.eraseKey(key);
+  }
+
+ private:
+  std::mutex mutex_;
+  BaselineMap map_;
+};
+
+template <typename Map>
+void worker(Map &map, unsigned seed, long &hits) {
+  s21::bench::Random random(seed);
+  long found = 0;
+  for (int i = 0; i < kOpsPerThread; ++i) {
+    int key = static_cast<int>(random.below(kKeyRange));
+    unsigned op = random.below(10);
+    if (op == 0) {
+      map.insert(key, i);
+    } else if (op == 1) {
+      map.erase(key);
+    } else {
+      found += map.contains(key);
+    }
+  }
+  hits = found;
+}
+
+template <typename Map>
+void run(const char *name, int threads) {
+  Map map;
+  for (int key = 0; key < kKeyRange; key += 2) map.insert(key, key);
+
+  std::vector<std::thread> pool;
+  std::vector<long> hits(threads);
+  s21::bench::Stopwatch watch;
+  for (int t = 0; t < threads; ++t) {
+    pool.emplace_back([&map, &hits, t] {
+      worker(map, 977U * (t + 1), hits[t]);
+    });
+  }
+  for (auto &thread : pool) thread.join();
+  double seconds = watch.seconds();
+
+  s21::bench::printRow(std::string(name) + " x" + std::to_string(threads),
+                       seconds, static_cast<std::uint64_t>(threads) *
+                                    kOpsPerThread);
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::printHeader(
+      "ordered map, 80% contains / 10% insert / 10% erase");
+  for (int threads : {1, 2, 4, 8}) {
+    run<LockedMap>("mutex + s21::map", threads);
+    run<s21::concurrent_skiplist_map<int, int>>("s21::concurrent_skiplist_map",
+                                                threads);
+  }
+  return 0;
+}
@@ -0,0 +1,52 @@
+#include <string>
+#include <vector>
+
+#include "../indexed_list/s21_indexed_list.h"
+#include "../list/s21_list.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+const int kElements = 1000000;
+
+// Half the operations insert at a random index, half read one; s21::list
+// walks to every position, so it gets far fewer operations.
+template <typename Sequence, typename InsertAt>
+void run(const std::string &name, int ops, InsertAt insert_at) {
+  Sequence sequence;
+  for (int i = 0; i < kElements; ++i) sequence.push_back(i);
+  s21::bench::Random random(21);
+  long long sum = 0;
+  s21::bench::Stopwatch watch;
+  for (int i = 0; i < ops; ++i) {
+    auto index = random.below(sequence.size());
+    if (i % 2 == 0) {
+      insert_at(sequence, index, i);
+    } else {
+      sum += sequence[static_cast<int>(index)];
+    }
+  }
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(sum);
+  s21::bench::printRow(name, seconds, ops);
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::printHeader("1M elements, random positional insert + read");
+  run<s21::indexed_list<int>>(
+      "s21::indexed_list (1M ops)", 1000000,
+      [](auto &s, std::size_t at, int value) { s.insert_at(at, value); });
+  run<std::vector<int>>("std::vector (100k ops)", 100000,
+                        [](auto &s, std::size_t at, int value) {
+                          s.insert(s.begin() + at, value);
+                        });
+  run<s21::list<int>>("s21::list (2k ops)", 2000,
+                      [](auto &s, std::size_t at, int value) {
+                        auto it = s.begin();
+                        for (std::size_t i = 0; i < at; ++i) ++it;
+                        s.insert(it, value);
+                      });
+  return 0;
+}
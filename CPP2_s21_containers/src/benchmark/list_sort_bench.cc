@@ -0,0 +1,33 @@
+#include <list>
+#include <string>
+
+#include "../list/s21_list.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+template <typename List>
+void run(const char *name, int count) {
+  s21::bench::Random random(21);
+  List list;
+  for (int i = 0; i < count; ++i) {
+    list.push_back(static_cast<int>(random.below(1U << 30)));
+  }
+  s21::bench::Stopwatch watch;
+  list.sort();
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(list.front());
+  s21::bench::printRow(std::string(name) + " " + std::to_string(count),
+                       seconds, count);
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::printHeader("list::sort on random ints");
+  for (int count : {1000000, 10000000}) {
+    run<s21::list<int>>("s21::list::sort", count);
+    run<std::list<int>>("std::list::sort", count);
+  }
+  return 0;
+}
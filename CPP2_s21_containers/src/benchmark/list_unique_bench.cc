@@ -0,0 +1,57 @@
+#include <list>
+#include <string>
+#include <unordered_set>
+
+#include "../list/s21_list.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+const int kEvents = 5000000;
+
+// Event ids with heavy repetition: runs of repeats plus ids that come back
+// much later, as in a merged event log.
+template <typename List>
+List events() {
+  s21::bench::Random random(13);
+  List list;
+  int id = 0;
+  for (int i = 0; i < kEvents; ++i) {
+    if (random.below(4) != 0) id = static_cast<int>(random.below(1000000));
+    list.push_back(id);
+  }
+  return list;
+}
+
+template <typename List, typename Clean>
+void run(const std::string &name, Clean clean) {
+  List list = events<List>();
+  s21::bench::Stopwatch watch;
+  clean(list);
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(list.size());
+  s21::bench::printRow(name + " -> " + std::to_string(list.size()), seconds,
+                       kEvents);
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::printHeader("5M event ids, 1M distinct");
+  run<s21::list<int>>("s21::list::unique", [](auto &l) { l.unique(); });
+  run<std::list<int>>("std::list::unique", [](auto &l) { l.unique(); });
+  run<s21::list<int>>("s21::list::dedup", [](auto &l) { l.dedup(); });
+  run<std::list<int>>("std::list + unordered_set", [](auto &l) {
+    std::unordered_set<int> seen(l.size());
+    for (auto it = l.begin(); it != l.end();) {
+      it = seen.insert(*it).second ? ++it : l.erase(it);
+    }
+  });
+  run<s21::list<int>>("s21::list::sort_unique",
+                      [](auto &l) { l.sort_unique(); });
+  run<std::list<int>>("std::list::sort + unique", [](auto &l) {
+    l.sort();
+    l.unique();
+  });
+  return 0;
+}
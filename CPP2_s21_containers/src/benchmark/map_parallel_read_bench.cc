@@ -0,0 +1,58 @@
+#include <thread>
+#include <vector>
+
+#include "../map/s21_map.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+const int kKeys = 20000;
+const int kLookupsPerThread = 400000;
+const int kScansPerThread = 10;
+
+// Every reader works on the same const map without any locking.
+void reader(const s21::map<int, int> &frozen, unsigned seed, long &result) {
+  s21::bench::Random random(seed);
+  long sum = 0;
+  for (int i = 0; i < kLookupsPerThread; ++i) {
+    int key = static_cast<int>(random.below(2 * kKeys));
+    if (frozen.contains(key)) sum += frozen.at(key);
+  }
+  for (int scan = 0; scan < kScansPerThread; ++scan) {
+    for (auto it = frozen.begin(); it != frozen.end(); ++it) {
+      sum += (*it).second;
+    }
+  }
+  result = sum;
+}
+
+}  // namespace
+
+int main() {
+  s21::map<int, int> map;
+  for (int key = 0; key < 2 * kKeys; key += 2) map.insert(key, key);
+  const s21::map<int, int> &frozen = map;
+
+  s21::bench::printHeader("frozen s21::map, lock-free parallel readers");
+  double single = 0;
+  for (int threads : {1, 2, 4, 8, 16}) {
+    std::vector<std::thread> pool;
+    std::vector<long> results(threads);
+    s21::bench::Stopwatch watch;
+    for (int t = 0; t < threads; ++t) {
+      pool.emplace_back([&frozen, &results, t] {
+        reader(frozen, 131U * (t + 1), results[t]);
+      });
+    }
+    for (auto &thread : pool) thread.join();
+    double seconds = watch.seconds();
+    if (threads == 1) single = seconds;
+
+    std::uint64_t ops = static_cast<std::uint64_t>(threads) *
+                        (kLookupsPerThread + kScansPerThread * kKeys);
+    s21::bench::printRow("readers x" + std::to_string(threads), seconds, ops);
+    std::printf("%-44s %10.2fx\n", "  throughput vs 1 reader",
+                seconds > 0 ? single * threads / seconds : 0.0);
+  }
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "../mmap_vector/s21_mmap_vector.h"
+#include "../vector/s21_vector.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+struct Record {
+  std::int64_t id;
+  double price;
+  std::int32_t qty;
+  std::int32_t flags;
+};
+
+// 128 MiB: large next to the caches, small enough for a CI disk. The file
+// stays in the page cache, so rows measure copying rather than the disk.
+const std::size_t kRecords = 128 * 1024 * 1024 / sizeof(Record);
+const int kRounds = 5;
+
+void writeFile(const std::string &path) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  s21::bench::Random random(31);
+  for (std::size_t i = 0; i < kRecords; ++i) {
+    Record r{static_cast<std::int64_t>(i), random.below(10000) / 100.0,
+             static_cast<std::int32_t>(random.below(100)), 0};
+    out.write(reinterpret_cast<const char *>(&r), sizeof(r));
+  }
+}
+
+template <typename Records>
+std::int64_t sumQty(Records &records) {
+  std::int64_t sum = 0;
+  for (const Record &r : records) sum += r.qty;
+  return sum;
+}
+
+void loadIntoVector(const std::string &path, bool scan) {
+  s21::bench::Stopwatch watch;
+  for (int r = 0; r < kRounds; ++r) {
+    std::ifstream in(path, std::ios::binary);
+    s21::vector<Record> records(kRecords);
+    in.read(reinterpret_cast<char *>(records.data()),
+            kRecords * sizeof(Record));
+    s21::bench::doNotOptimize(scan ? sumQty(records) : records[0].id);
+  }
+  s21::bench::printRow(scan ? "s21::vector read + scan" : "s21::vector read",
+                       watch.seconds(), kRounds);
+}
+
+void openMapped(const std::string &path, bool scan) {
+  using mapped = s21::mmap_vector<Record>;
+  s21::bench::Stopwatch watch;
+  for (int r = 0; r < kRounds; ++r) {
+    mapped records(path, mapped::open_mode::read_only);
+    records.advise(mapped::access::sequential);
+    s21::bench::doNotOptimize(scan ? sumQty(records) : records.size());
+  }
+  s21::bench::printRow(scan ? "mmap_vector open + scan" : "mmap_vector open",
+                       watch.seconds(), kRounds);
+}
+
+}  // namespace
+
+int main() {
+  std::string path =
+      "/tmp/s21_mmap_vector_bench_" + std::to_string(::getpid());
+  writeFile(path);
+  s21::bench::printHeader("128 MiB of 24-byte records, ns per load");
+  loadIntoVector(path, false);
+  openMapped(path, false);
+  loadIntoVector(path, true);
+  openMapped(path, true);
+  std::remove(path.c_str());
+  return 0;
+}
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <thread>
+
+#include "../thread_pool/s21_parallel.h"
+#include "../thread_pool/s21_thread_pool.h"
+#include "../vector/s21_vector.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+const int kElements = 2 * 1024 * 1024;
+
+s21::vector<int> makeData() {
+  s21::bench::Random random(23);
+  s21::vector<int> data;
+  for (int i = 0; i < kElements; ++i) {
+    data.push_back(static_cast<int>(random.below(1u << 30)));
+  }
+  return data;
+}
+
+// Times one call on a fresh copy of the input; rows report ns per element.
+template <typename Run>
+void row(const std::string &name, const s21::vector<int> &input, Run run) {
+  s21::vector<int> data = input;
+  s21::bench::Stopwatch watch;
+  run(data);
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(data[kElements / 2]);
+  s21::bench::printRow(name, seconds, kElements);
+}
+
+void runSerial(const s21::vector<int> &input) {
+  s21::bench::printHeader("std, 1 thread");
+  row("sort", input,
+      [](s21::vector<int> &v) { std::sort(v.begin(), v.end()); });
+  row("stable_sort", input,
+      [](s21::vector<int> &v) { std::stable_sort(v.begin(), v.end()); });
+  row("transform sqrt", input, [](s21::vector<int> &v) {
+    std::transform(v.begin(), v.end(), v.begin(), [](int x) {
+      return static_cast<int>(std::sqrt(static_cast<double>(x)));
+    });
+  });
+  row("accumulate", input, [](s21::vector<int> &v) {
+    s21::bench::doNotOptimize(std::accumulate(v.begin(), v.end(), 0L));
+  });
+  row("partial_sum", input, [](s21::vector<int> &v) {
+    std::partial_sum(v.begin(), v.end(), v.begin());
+  });
+}
+
+void runParallel(const s21::vector<int> &input, std::size_t threads) {
+  s21::thread_pool pool(threads);
+  s21::bench::printHeader("s21::parallel, " + std::to_string(threads) +
+                          " threads");
+  row("sort", input, [&](s21::vector<int> &v) {
+    s21::parallel::sort(pool, v.begin(), v.end());
+  });
+  row("stable_sort", input, [&](s21::vector<int> &v) {
+    s21::parallel::stable_sort(pool, v.begin(), v.end());
+  });
+  row("transform sqrt", input, [&](s21::vector<int> &v) {
+    s21::parallel::transform(pool, v.begin(), v.end(), v.begin(), [](int x) {
+      return static_cast<int>(std::sqrt(static_cast<double>(x)));
+    });
+  });
+  row("reduce", input, [&](s21::vector<int> &v) {
+    s21::bench::doNotOptimize(
+        s21::parallel::reduce(pool, v.begin(), v.end(), 0L));
+  });
+  row("inclusive_scan", input, [&](s21::vector<int> &v) {
+    s21::parallel::inclusive_scan(pool, v.begin(), v.end(), v.begin());
+  });
+}
+
+}  // namespace
+
+// Speedup is bounded by the cores present; with fewer cores than threads
+// the extra rows only show the cost of oversubscription.
+int main() {
+  s21::vector<int> input = makeData();
+  std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+  runSerial(input);
+  for (std::size_t threads : {1, 2, 4, 8, 16, 32}) {
+    runParallel(input, threads);
+  }
+  return 0;
+}
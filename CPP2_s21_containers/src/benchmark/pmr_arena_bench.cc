@@ -0,0 +1,85 @@
+#include <memory_resource>
+
+#include "../pmr/s21_pmr.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+const int kRequests = 200000;
+
+// One request: parse a batch of ids into a vector, index them in a map and
+// a set, queue follow-ups in a list, and answer with a checksum. Everything
+// is dropped when the request ends.
+template <typename Vector, typename List, typename Map, typename Set>
+long handle(int request, std::pmr::memory_resource *resource) {
+  Vector ids(resource);
+  Map counts(resource);
+  Set seen(resource);
+  List follow_ups(resource);
+  int n = 32 + request % 64;
+  for (int i = 0; i < n; ++i) {
+    int id = (request * 31 + i * 17) % 97;
+    ids.push_back(id);
+    counts[id] += 1;
+    seen.insert(id);
+    if (id % 3 == 0) follow_ups.push_back(id);
+  }
+  long sum = static_cast<long>(seen.size()) + follow_ups.size();
+  for (int id : ids) sum += counts.at(id);
+  return sum;
+}
+
+using pmr_handler = long (*)(int, std::pmr::memory_resource *);
+
+const pmr_handler handlePmr =
+    handle<s21::pmr::vector<int>, s21::pmr::list<int>, s21::pmr::map<int, int>,
+           s21::pmr::set<int>>;
+
+void runHeap() {
+  long sum = 0;
+  s21::bench::Stopwatch watch;
+  for (int r = 0; r < kRequests; ++r) {
+    sum += handlePmr(r, std::pmr::new_delete_resource());
+  }
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(sum);
+  s21::bench::printRow("s21::pmr + new_delete_resource", seconds, kRequests);
+}
+
+void runArena() {
+  long sum = 0;
+  s21::bench::Stopwatch watch;
+  for (int r = 0; r < kRequests; ++r) {
+    alignas(std::max_align_t) unsigned char buffer[16 * 1024];
+    s21::arena_resource arena(buffer, sizeof(buffer));
+    sum += handlePmr(r, &arena);
+  }
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(sum);
+  s21::bench::printRow("s21::pmr + arena_resource (stack buffer)", seconds,
+                       kRequests);
+}
+
+void runReusedArena() {
+  long sum = 0;
+  s21::arena_resource arena(64 * 1024);
+  s21::bench::Stopwatch watch;
+  for (int r = 0; r < kRequests; ++r) {
+    sum += handlePmr(r, &arena);
+    arena.release();
+  }
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(sum);
+  s21::bench::printRow("s21::pmr + arena_resource (release/request)",
+                       seconds, kRequests);
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::printHeader("200k requests of 32-95 ids each");
+  runHeap();
+  runArena();
+  runReusedArena();
+  return 0;
+}
@@ -0,0 +1,64 @@
+#include <list>
+#include <memory>
+#include <queue>
+#include <string>
+
+#include "../queue/s21_queue.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+const int kOps = 10000000;
+
+// Keeps depth elements queued while pushing and popping kOps times.
+template <typename Queue>
+void steady(const char *name, int depth) {
+  Queue queue;
+  for (int i = 0; i < depth; ++i) queue.push(i);
+  long sum = 0;
+  s21::bench::Stopwatch watch;
+  for (int i = 0; i < kOps; ++i) {
+    queue.push(i);
+    sum += queue.front();
+    queue.pop();
+  }
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(sum);
+  s21::bench::printRow(std::string(name) + " depth " + std::to_string(depth),
+                       seconds, kOps);
+}
+
+// Fills the queue with kOps elements, then drains it.
+template <typename Queue>
+void fillDrain(const char *name) {
+  Queue queue;
+  long sum = 0;
+  s21::bench::Stopwatch watch;
+  for (int i = 0; i < kOps; ++i) queue.push(i);
+  while (!queue.empty()) {
+    sum += queue.front();
+    queue.pop();
+  }
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(sum);
+  s21::bench::printRow(std::string(name) + " fill/drain", seconds, kOps);
+}
+
+using pooled = s21::queue<int, s21::pooled_list<int>>;
+using heap = s21::queue<int>;
+using standard = std::queue<int, std::list<int>>;
+
+}  // namespace
+
+int main() {
+  s21::bench::printHeader("queue push + pop, 10M operations");
+  for (int depth : {0, 1000, 100000}) {
+    steady<pooled>("s21::queue (pool_allocator)", depth);
+    steady<heap>("s21::queue (std::allocator)", depth);
+    steady<standard>("std::queue<std::list>", depth);
+  }
+  fillDrain<pooled>("s21::queue (pool_allocator)");
+  fillDrain<heap>("s21::queue (std::allocator)");
+  fillDrain<standard>("std::queue<std::list>");
+  return 0;
+}
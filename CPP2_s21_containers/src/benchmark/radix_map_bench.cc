@@ -0,0 +1,118 @@
+#include <malloc.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../map/s21_map.h"
+#include "../radix_map/s21_radix_map.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+// Heap bytes currently in use, as reported by the allocator itself.
+std::size_t live_bytes = 0;
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+  void *ptr = std::malloc(size != 0 ? size : 1);
+  if (ptr == nullptr) throw std::bad_alloc();
+  live_bytes += malloc_usable_size(ptr);
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+  if (ptr == nullptr) return;
+  live_bytes -= malloc_usable_size(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept { operator delete(ptr); }
+
+namespace {
+
+const int kLookups = 2000000;
+
+// URLs and metric names: a few hosts and services, deep shared paths and
+// numeric ids at the leaves.
+std::vector<std::string> corpus() {
+  const char *hosts[] = {"https://api.example.com", "https://cdn.example.com",
+                         "https://shop.example.org", "https://docs.example.io"};
+  const char *sections[] = {"/v1/users/", "/v1/orders/", "/v2/products/",
+                            "/v2/inventory/", "/static/images/"};
+  const char *actions[] = {"/profile", "/history", "/settings", "/items"};
+  const char *services[] = {"frontend", "billing", "search", "auth"};
+  const char *metrics[] = {".http.requests.count", ".http.latency.p50",
+                           ".http.latency.p99", ".db.pool.in_use"};
+  std::vector<std::string> keys;
+  s21::bench::Random random(3);
+  for (int i = 0; i < 300000; ++i) {
+    keys.push_back(std::string(hosts[random.below(4)]) +
+                   sections[random.below(5)] +
+                   std::to_string(random.below(1000000)) +
+                   actions[random.below(4)]);
+  }
+  for (int i = 0; i < 100000; ++i) {
+    keys.push_back("service." + std::string(services[random.below(4)]) +
+                   ".instance-" + std::to_string(random.below(5000)) +
+                   metrics[random.below(4)]);
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  for (std::size_t i = keys.size() - 1; i > 0; --i) {
+    std::swap(keys[i], keys[random.below(i + 1)]);
+  }
+  return keys;
+}
+
+template <typename Map>
+void run(const char *name, const std::vector<std::string> &keys,
+         const std::vector<std::string> &queries) {
+  std::size_t before = live_bytes;
+  Map *map = new Map;
+  s21::bench::Stopwatch build;
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    map->insert(keys[i], static_cast<int>(i));
+  }
+  double build_seconds = build.seconds();
+  std::size_t used = live_bytes - before;
+
+  long sum = 0;
+  s21::bench::Stopwatch lookup;
+  for (const auto &key : queries) sum += map->at(key);
+  double lookup_seconds = lookup.seconds();
+  s21::bench::doNotOptimize(sum);
+
+  s21::bench::printRow(std::string(name) + " insert", build_seconds,
+                       keys.size());
+  s21::bench::printRow(std::string(name) + " at", lookup_seconds,
+                       queries.size());
+  std::printf("%-44s %10.1f MiB %10.1f B/key\n",
+              (std::string(name) + " heap").c_str(), used / 1048576.0,
+              static_cast<double>(used) / keys.size());
+  delete map;
+}
+
+}  // namespace
+
+int main() {
+  std::vector<std::string> keys = corpus();
+  std::size_t key_bytes = 0;
+  for (const auto &key : keys) key_bytes += key.size();
+
+  s21::bench::Random random(17);
+  std::vector<std::string> queries(kLookups);
+  for (auto &query : queries) query = keys[random.below(keys.size())];
+
+  s21::bench::printHeader(std::to_string(keys.size()) +
+                          " URL and metric keys, " +
+                          std::to_string(key_bytes / keys.size()) +
+                          " bytes on average");
+  run<s21::map<std::string, int>>("s21::map<std::string, int>", keys,
+                                  queries);
+  run<s21::radix_map<int>>("s21::radix_map<int>", keys, queries);
+  return 0;
+}
@@ -0,0 +1,64 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_BENCHMARK_S21_BENCHMARK_H
+#define CPP2_S21_CONTAINERS_2_SRC_BENCHMARK_S21_BENCHMARK_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace s21 {
+namespace bench {
+
+class Stopwatch {
+ public:
+  Stopwatch() : start_(std::chrono::steady_clock::now()) {}
+
+  double seconds() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start_)
+        .count();
+  }
+
+ private:
+  std::chrono::steady_clock::time_point start_;
+};
+
+// Small deterministic generator so every run sees the same key sequence.
+class Random {
+ public:
+  explicit Random(std::uint64_t seed = 0x2545F4914F6CDD1DULL)
+      : state_(seed | 1U) {}
+
+  std::uint64_t next() {
+    state_ ^= state_ << 13;
+    state_ ^= state_ >> 7;
+    state_ ^= state_ << 17;
+    return state_;
+  }
+
+  std::uint64_t below(std::uint64_t bound) { return next() % bound; }
+
+ private:
+  std::uint64_t state_;
+};
+
+// Keeps the optimizer from discarding a computed value.
+template <typename T>
+inline void doNotOptimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void printHeader(const std::string &title) {
+  std::printf("\n== %s ==\n", title.c_str());
+}
+
+inline void printRow(const std::string &name, double seconds,
+                     std::uint64_t ops) {
+  std::printf("%-44s %10.3f ms %10.1f ns/op\n", name.c_str(), seconds * 1e3,
+              ops > 0 ? seconds * 1e9 / ops : 0.0);
+}
+
+}  // namespace bench
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_BENCHMARK_S21_BENCHMARK_H
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+
+#include "../simd/s21_simd.h"
+#include "../vector/s21_vector.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+// 256 KiB per buffer stays in L2, so the rows compare the kernels rather
+// than memory bandwidth.
+const int kElements = 64 * 1024;
+const int kRounds = 2000;
+
+template <typename T>
+s21::vector<T> makeData() {
+  s21::bench::Random random(11);
+  s21::vector<T> data;
+  for (int i = 0; i < kElements; ++i) {
+    data.push_back(static_cast<T>(random.below(1000)));
+  }
+  return data;
+}
+
+template <typename Scan>
+void row(const std::string &name, Scan scan) {
+  long sum = 0;
+  s21::bench::Stopwatch watch;
+  for (int r = 0; r < kRounds; ++r) sum += static_cast<long>(scan());
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(sum);
+  s21::bench::printRow(name, seconds, kRounds);
+}
+
+// The needle is absent, so find and count walk the whole buffer.
+template <typename T>
+void runType(const char *type) {
+  s21::vector<T> data = makeData<T>();
+  const T *first = data.data();
+  const T *last = first + data.size();
+  const T needle = static_cast<T>(5000);
+  s21::bench::printHeader(std::string(type) + ", ns per 64K-element scan");
+
+  row("find        std",
+      [&] { return std::find(first, last, needle) - first; });
+  row("count       std", [&] { return std::count(first, last, needle); });
+  row("min_element std", [&] { return *std::min_element(first, last); });
+  row("accumulate  std", [&] { return std::accumulate(first, last, T()); });
+
+  using s21::simd::isa;
+  for (isa level : {isa::scalar, isa::sse2, isa::avx2, isa::avx512}) {
+    if (level > s21::simd::detected_isa()) continue;
+    const s21::simd::kernels<T> &k = s21::simd::kernels_for<T>(level);
+    std::string suffix = s21::simd::isa_name(level);
+    row("find        " + suffix,
+        [&] { return k.find(first, last, needle) - first; });
+    row("count       " + suffix, [&] { return k.count(first, last, needle); });
+    row("min_element " + suffix, [&] { return *k.min_element(first, last); });
+    row("accumulate  " + suffix,
+        [&] { return k.accumulate(first, last, T()); });
+  }
+}
+
+}  // namespace
+
+int main() {
+  runType<std::int32_t>("int32_t");
+  runType<float>("float");
+  return 0;
+}
@@ -0,0 +1,84 @@
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "../small_vector/s21_small_vector.h"
+#include "../vector/s21_vector.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+std::size_t allocations = 0;
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  void *ptr = std::malloc(size != 0 ? size : 1);
+  if (ptr == nullptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace {
+
+const int kRecords = 1000000;
+
+// Comma separated records of 1 to 12 numeric fields, most of them short.
+std::string makeInput() {
+  s21::bench::Random random(5);
+  std::string input;
+  for (int i = 0; i < kRecords; ++i) {
+    int fields = 1 + static_cast<int>(random.below(6));
+    if (random.below(10) == 0) fields += 6;
+    for (int f = 0; f < fields; ++f) {
+      if (f != 0) input += ',';
+      input += std::to_string(random.below(100000));
+    }
+    input += '\n';
+  }
+  return input;
+}
+
+// Splits every record into a fresh Fields vector, as a parser building one
+// row object per line would.
+template <typename Fields>
+void run(const std::string &name, const std::string &input) {
+  std::size_t before = allocations;
+  long long sum = 0;
+  s21::bench::Stopwatch watch;
+  const char *p = input.data();
+  const char *end = p + input.size();
+  while (p != end) {
+    Fields fields;
+    int value = 0;
+    for (; *p != '\n'; ++p) {
+      if (*p == ',') {
+        fields.push_back(value);
+        value = 0;
+      } else {
+        value = value * 10 + (*p - '0');
+      }
+    }
+    fields.push_back(value);
+    ++p;
+    sum += fields.back() + static_cast<long long>(fields.size());
+  }
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(sum);
+  s21::bench::printRow(name, seconds, kRecords);
+  std::printf("%-44s %10zu allocations\n", "", allocations - before);
+}
+
+}  // namespace
+
+int main() {
+  std::string input = makeInput();
+  s21::bench::printHeader("parse 1M records of 1-12 fields");
+  run<s21::vector<int>>("s21::vector<int>", input);
+  run<s21::small_vector<int, 8>>("s21::small_vector<int, 8>", input);
+  return 0;
+}
@@ -0,0 +1,72 @@
+#include <cstdint>
+#include <string>
+
+#include "../simd/s21_simd.h"
+#include "../soa_vector/s21_soa_vector.h"
+#include "../vector/s21_vector.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+// A 64-byte record of which the scans read one 4-byte field.
+struct Order {
+  std::int64_t id;
+  std::int64_t account;
+  double price;
+  double fee;
+  std::int32_t qty;
+  std::int32_t venue;
+  std::int64_t sent;
+  std::int64_t acked;
+  std::int64_t flags;
+};
+
+using Orders = s21::soa_vector<std::int64_t, std::int64_t, double, double,
+                               std::int32_t, std::int32_t, std::int64_t,
+                               std::int64_t, std::int64_t>;
+
+// 64 MiB of records, well past the last-level cache.
+const int kOrders = 1024 * 1024;
+const int kRounds = 20;
+
+template <typename Scan>
+void row(const std::string &name, Scan scan) {
+  std::int64_t sum = 0;
+  s21::bench::Stopwatch watch;
+  for (int r = 0; r < kRounds; ++r) sum += scan();
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(sum);
+  s21::bench::printRow(name, seconds, static_cast<std::uint64_t>(kRounds) *
+                                          kOrders);
+}
+
+}  // namespace
+
+int main() {
+  s21::vector<Order> aos;
+  Orders soa;
+  soa.reserve(kOrders);
+  s21::bench::Random random(47);
+  for (int i = 0; i < kOrders; ++i) {
+    std::int32_t qty = static_cast<std::int32_t>(random.below(100));
+    aos.push_back(Order{i, i % 977, 10.0, 0.1, qty, i % 7, i, i, 0});
+    soa.emplace_back(i, i % 977, 10.0, 0.1, qty, i % 7, i, i, 0);
+  }
+
+  s21::bench::printHeader("sum of one int32 field, ns per record");
+  row("AoS s21::vector<Order>", [&] {
+    std::int64_t sum = 0;
+    for (const Order &order : aos) sum += order.qty;
+    return sum;
+  });
+  row("SoA column loop", [&] {
+    std::int64_t sum = 0;
+    for (std::int32_t qty : soa.column<4>()) sum += qty;
+    return sum;
+  });
+  row("SoA column simd::accumulate", [&] {
+    return static_cast<std::int64_t>(
+        s21::simd::accumulate(soa.column<4>(), 0));
+  });
+  return 0;
+}
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../set/s21_set.h"
+#include "../static_set/s21_static_set.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+const int kKeys = 1 << 20;
+const int kLookups = 4000000;
+
+template <typename Contains>
+void run(const char *name, const std::vector<std::uint64_t> &queries,
+         Contains contains) {
+  long hits = 0;
+  s21::bench::Stopwatch watch;
+  for (std::uint64_t key : queries) hits += contains(key);
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(hits);
+  s21::bench::printRow(name, seconds, queries.size());
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::Random random(5);
+  s21::set<std::uint64_t> source;
+  std::vector<std::uint64_t> sorted;
+  for (int i = 0; i < kKeys; ++i) {
+    std::uint64_t key = random.next();
+    source.insert(key);
+    sorted.push_back(key);
+  }
+  std::sort(sorted.begin(), sorted.end());
+  s21::static_set<std::uint64_t> frozen(source);
+
+  // Half of the queries hit, half miss.
+  std::vector<std::uint64_t> queries(kLookups);
+  for (auto &query : queries) {
+    query = random.below(2) ? sorted[random.below(sorted.size())]
+                            : random.next();
+  }
+
+  s21::bench::printHeader("membership tests, 1M uint64 keys");
+  run("s21::set::contains", queries,
+      [&source](std::uint64_t key) { return source.contains(key); });
+  run("std::binary_search on a sorted array", queries,
+      [&sorted](std::uint64_t key) {
+        return std::binary_search(sorted.begin(), sorted.end(), key);
+      });
+  run("s21::static_set::contains", queries,
+      [&frozen](std::uint64_t key) { return frozen.contains(key); });
+
+  std::unique_ptr<bool[]> result(new bool[queries.size()]);
+  s21::bench::Stopwatch watch;
+  frozen.contains_many(queries.data(), queries.size(), result.get());
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(result[queries.size() - 1]);
+  s21::bench::printRow("s21::static_set::contains_many", seconds,
+                       queries.size());
+  return 0;
+}
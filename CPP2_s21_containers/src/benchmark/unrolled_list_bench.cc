@@ -0,0 +1,125 @@
+#include <malloc.h>
+
+#include <cstdlib>
+#include <list>
+#include <memory>
+#include <new>
+#include <string>
+
+#include "../list/s21_list.h"
+#include "../unrolled_list/s21_unrolled_list.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+// Heap bytes currently in use, as reported by the allocator itself.
+std::size_t live_bytes = 0;
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+  void *ptr = std::malloc(size != 0 ? size : 1);
+  if (ptr == nullptr) throw std::bad_alloc();
+  live_bytes += malloc_usable_size(ptr);
+  return ptr;
+}
+
+void *operator new(std::size_t size, std::align_val_t align) {
+  std::size_t alignment = static_cast<std::size_t>(align);
+  void *ptr = std::aligned_alloc(
+      alignment, (size + alignment - 1) / alignment * alignment);
+  if (ptr == nullptr) throw std::bad_alloc();
+  live_bytes += malloc_usable_size(ptr);
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+  if (ptr == nullptr) return;
+  live_bytes -= malloc_usable_size(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept { operator delete(ptr); }
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+  operator delete(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept {
+  operator delete(ptr);
+}
+
+namespace {
+
+const int kElements = 4000000;
+const int kScans = 3;
+
+struct Particle {
+  int id;
+  float x;
+  float y;
+};
+
+long weight(int value) { return value; }
+long weight(const Particle &value) { return value.id; }
+
+int make(s21::bench::Random &random, int) {
+  return static_cast<int>(random.below(1U << 30));
+}
+
+Particle make(s21::bench::Random &random, Particle) {
+  int id = static_cast<int>(random.below(1U << 30));
+  return {id, 1.0f, 2.0f};
+}
+
+struct ById {
+  bool operator()(int a, int b) const { return a < b; }
+  bool operator()(const Particle &a, const Particle &b) const {
+    return a.id < b.id;
+  }
+};
+
+// Builds the list from random values and sorts it, so a node-based list is
+// scanned in an order unrelated to where its nodes were allocated.
+template <typename List>
+void run(const char *name) {
+  using value_type = typename List::value_type;
+  s21::bench::Random random(9);
+  std::size_t before = live_bytes;
+  List *list = new List;
+  for (int i = 0; i < kElements; ++i) {
+    list->push_back(make(random, value_type()));
+  }
+  std::size_t used = live_bytes - before;
+  list->sort(ById());
+
+  long sum = 0;
+  s21::bench::Stopwatch watch;
+  for (int scan = 0; scan < kScans; ++scan) {
+    for (const auto &item : *list) sum += weight(item);
+  }
+  double seconds = watch.seconds();
+  s21::bench::doNotOptimize(sum);
+  s21::bench::printRow(std::string(name) + " scan", seconds,
+                       static_cast<std::uint64_t>(kElements) * kScans);
+  std::printf("%-44s %10.1f MiB %10.1f B/elem\n",
+              (std::string(name) + " heap").c_str(), used / 1048576.0,
+              static_cast<double>(used) / kElements);
+  delete list;
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::printHeader("4M sorted ints, 3 full scans");
+  run<s21::list<int>>("s21::list<int>");
+  run<s21::list<int, std::allocator<int>>>("s21::list<int, std::allocator>");
+  run<s21::unrolled_list<int>>("s21::unrolled_list<int>");
+
+  s21::bench::printHeader("4M sorted 12-byte structs, 3 full scans");
+  run<s21::list<Particle>>("s21::list<Particle>");
+  run<s21::list<Particle, std::allocator<Particle>>>(
+      "s21::list<Particle, std::allocator>");
+  run<s21::unrolled_list<Particle>>("s21::unrolled_list<Particle>");
+  return 0;
+}
@@ -0,0 +1,45 @@
+#include <string>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "s21_benchmark.h"
+
+namespace {
+
+const int kElements = 2000000;
+const int kRounds = 5;
+
+// Every push_back starts from an empty vector, so the timing includes each
+// doubling of the buffer.
+template <typename Vector, typename Make>
+void run(const std::string &name, Make make) {
+  std::vector<typename Vector::value_type> values;
+  values.reserve(kElements);
+  for (int i = 0; i < kElements; ++i) values.push_back(make(i));
+  double seconds = 0;
+  for (int round = 0; round < kRounds; ++round) {
+    s21::bench::Stopwatch watch;
+    Vector vector;
+    for (const auto &value : values) vector.push_back(value);
+    seconds += watch.seconds();
+    s21::bench::doNotOptimize(vector.size());
+  }
+  s21::bench::printRow(name, seconds / kRounds, kElements);
+}
+
+}  // namespace
+
+int main() {
+  auto number = [](int i) { return i; };
+  // Long enough to defeat the small-string buffer.
+  auto text = [](int i) { return "element number " + std::to_string(i); };
+
+  s21::bench::printHeader("push_back 2M int");
+  run<s21::vector<int>>("s21::vector<int>", number);
+  run<std::vector<int>>("std::vector<int>", number);
+
+  s21::bench::printHeader("push_back 2M std::string");
+  run<s21::vector<std::string>>("s21::vector<std::string>", text);
+  run<std::vector<std::string>>("std::vector<std::string>", text);
+  return 0;
+}
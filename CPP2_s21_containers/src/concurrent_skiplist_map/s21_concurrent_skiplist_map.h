@@ -0,0 +1,477 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_CONCURRENT_SKIPLIST_MAP_S21_CONCURRENT_SKIPLIST_MAP_H
+#define CPP2_S21_CONTAINERS_2_SRC_CONCURRENT_SKIPLIST_MAP_S21_CONCURRENT_SKIPLIST_MAP_H
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+#include "s21_epoch.h"
+
+namespace s21 {
+
+// Ordered map with lock-free insert, find and erase (Fraser/Herlihy skip
+// list). Tower links carry a "deleted" mark in their low bit; erase marks the
+// links of a node top-down and the level-0 mark decides the winner. Unlinked
+// nodes are reclaimed through EpochDomain: a node is retired by whichever of
+// its inserter and its eraser finishes last, so neither can link it back
+// after the other has unlinked it.
+//
+// Iterators pin the epoch of the thread that created them, so the node they
+// point to stays readable even if it is erased concurrently. They must not be
+// passed to another thread. Iteration is weakly consistent. clear() and the
+// destructor need exclusive access.
+template <typename Key, typename T>
+class concurrent_skiplist_map {
+ public:
+  class Iterator;
+
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+  using size_type = size_t;
+
+  concurrent_skiplist_map();
+  concurrent_skiplist_map(std::initializer_list<value_type> const &items);
+  concurrent_skiplist_map(const concurrent_skiplist_map &) = delete;
+  concurrent_skiplist_map &operator=(const concurrent_skiplist_map &) = delete;
+  ~concurrent_skiplist_map();
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  size_type erase(const Key &key);
+  void erase(iterator pos);
+
+  iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  iterator lower_bound(const Key &key) const;
+  iterator upper_bound(const Key &key) const;
+
+  template <class... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+ private:
+  static constexpr int kMaxLevel = 24;
+
+  using Link = std::atomic<std::uintptr_t>;
+
+  struct alignas(Link) Node {
+    value_type value;
+    int level;
+    // One share for the inserter while it links the upper levels, one for
+    // the eraser; dropping the last share retires the node.
+    std::atomic<int> shares{2};
+
+    Link *links() { return reinterpret_cast<Link *>(this + 1); }
+  };
+
+  static Node *unmark(std::uintptr_t link) {
+    return reinterpret_cast<Node *>(link & ~std::uintptr_t{1});
+  }
+
+  static bool isMarked(std::uintptr_t link) { return (link & 1U) != 0; }
+
+  static std::uintptr_t pack(Node *node) {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  static Node *createNode(int level, const value_type &value);
+  static void destroyNode(void *ptr);
+  static int randomLevel();
+  static Node *nextAlive(Node *node);
+  static void release(Node *node);
+
+  bool find(const Key &key, Link **preds, Node **succs);
+  Node *lowerBoundNode(const Key &key) const;
+
+  Link head_[kMaxLevel];
+  std::atomic<size_type> size_;
+
+ public:
+  class Iterator {
+   public:
+    Iterator() : node_(nullptr) {}
+    explicit Iterator(Node *node) : node_(node) {}
+
+    reference operator*() const { return node_->value; }
+    value_type *operator->() const { return &node_->value; }
+
+    iterator &operator++() {
+      node_ = nextAlive(node_);
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator temp = *this;
+      node_ = nextAlive(node_);
+      return temp;
+    }
+
+    bool operator==(const Iterator &other) const {
+      return node_ == other.node_;
+    }
+
+    bool operator!=(const Iterator &other) const {
+      return node_ != other.node_;
+    }
+
+   private:
+    friend class concurrent_skiplist_map;
+
+    EpochDomain::Guard guard_;
+    Node *node_;
+  };
+};
+
+template <typename Key, typename T>
+concurrent_skiplist_map<Key, T>::concurrent_skiplist_map() : size_(0) {
+  for (auto &link : head_) link.store(0, std::memory_order_relaxed);
+}
+
+template <typename Key, typename T>
+concurrent_skiplist_map<Key, T>::concurrent_skiplist_map(
+    std::initializer_list<value_type> const &items)
+    : concurrent_skiplist_map() {
+  for (auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename T>
+concurrent_skiplist_map<Key, T>::~concurrent_skiplist_map() {
+  clear();
+}
+
+template <typename Key, typename T>
+typename concurrent_skiplist_map<Key, T>::iterator
+concurrent_skiplist_map<Key, T>::begin() const {
+  EpochDomain::Guard guard;
+  iterator it;
+  Node *first = unmark(head_[0].load(std::memory_order_acquire));
+  if (first != nullptr &&
+      isMarked(first->links()[0].load(std::memory_order_acquire))) {
+    first = nextAlive(first);
+  }
+  it.node_ = first;
+  return it;
+}
+
+template <typename Key, typename T>
+typename concurrent_skiplist_map<Key, T>::iterator
+concurrent_skiplist_map<Key, T>::end() const {
+  return iterator();
+}
+
+template <typename Key, typename T>
+bool concurrent_skiplist_map<Key, T>::empty() const {
+  return size() == 0;
+}
+
+template <typename Key, typename T>
+typename concurrent_skiplist_map<Key, T>::size_type
+concurrent_skiplist_map<Key, T>::size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+
+template <typename Key, typename T>
+typename concurrent_skiplist_map<Key, T>::size_type
+concurrent_skiplist_map<Key, T>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(Node);
+}
+
+template <typename Key, typename T>
+void concurrent_skiplist_map<Key, T>::clear() {
+  Node *node = unmark(head_[0].load(std::memory_order_acquire));
+  while (node != nullptr) {
+    Node *next = unmark(node->links()[0].load(std::memory_order_relaxed));
+    destroyNode(node);
+    node = next;
+  }
+  for (auto &link : head_) link.store(0, std::memory_order_relaxed);
+  size_.store(0, std::memory_order_relaxed);
+}
+
+template <typename Key, typename T>
+std::pair<typename concurrent_skiplist_map<Key, T>::iterator, bool>
+concurrent_skiplist_map<Key, T>::insert(const value_type &value) {
+  EpochDomain::Guard guard;
+  iterator it;
+  Link *preds[kMaxLevel];
+  Node *succs[kMaxLevel];
+  const int level = randomLevel();
+  Node *node = nullptr;
+
+  while (true) {
+    if (find(value.first, preds, succs)) {
+      if (node != nullptr) destroyNode(node);
+      it.node_ = succs[0];
+      return {it, false};
+    }
+    if (node == nullptr) node = createNode(level, value);
+    for (int i = 0; i < level; ++i) {
+      node->links()[i].store(pack(succs[i]), std::memory_order_relaxed);
+    }
+    std::uintptr_t expected = pack(succs[0]);
+    if (preds[0]->compare_exchange_strong(expected, pack(node),
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+      break;
+    }
+  }
+  size_.fetch_add(1, std::memory_order_relaxed);
+
+  bool linking = true;
+  for (int i = 1; i < level && linking; ++i) {
+    while (true) {
+      std::uintptr_t own = node->links()[i].load(std::memory_order_acquire);
+      if (isMarked(own) ||
+          (unmark(own) != succs[i] &&
+           !node->links()[i].compare_exchange_strong(
+               own, pack(succs[i]), std::memory_order_release,
+               std::memory_order_relaxed))) {
+        linking = false;
+        break;
+      }
+      std::uintptr_t expected = pack(succs[i]);
+      if (preds[i]->compare_exchange_strong(expected, pack(node),
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        break;
+      }
+      if (!find(value.first, preds, succs) || succs[0] != node) {
+        linking = false;
+        break;
+      }
+    }
+  }
+  // An erase that raced with the upper-level linking may have missed a tower
+  // link added after its own unlinking pass; finish the unlinking here,
+  // before the eraser can be the one to retire the node.
+  if (isMarked(node->links()[0].load(std::memory_order_acquire))) {
+    find(value.first, preds, succs);
+  }
+  release(node);
+
+  it.node_ = node;
+  return {it, true};
+}
+
+template <typename Key, typename T>
+std::pair<typename concurrent_skiplist_map<Key, T>::iterator, bool>
+concurrent_skiplist_map<Key, T>::insert(const Key &key, const T &obj) {
+  return insert(value_type(key, obj));
+}
+
+template <typename Key, typename T>
+typename concurrent_skiplist_map<Key, T>::size_type
+concurrent_skiplist_map<Key, T>::erase(const Key &key) {
+  EpochDomain::Guard guard;
+  Link *preds[kMaxLevel];
+  Node *succs[kMaxLevel];
+  if (!find(key, preds, succs)) return 0;
+
+  Node *node = succs[0];
+  for (int i = node->level - 1; i >= 1; --i) {
+    node->links()[i].fetch_or(1, std::memory_order_acq_rel);
+  }
+  if (isMarked(node->links()[0].fetch_or(1, std::memory_order_acq_rel))) {
+    return 0;
+  }
+  size_.fetch_sub(1, std::memory_order_relaxed);
+  find(key, preds, succs);
+  release(node);
+  return 1;
+}
+
+template <typename Key, typename T>
+void concurrent_skiplist_map<Key, T>::erase(iterator pos) {
+  if (pos.node_ != nullptr) erase(pos.node_->value.first);
+}
+
+template <typename Key, typename T>
+typename concurrent_skiplist_map<Key, T>::iterator
+concurrent_skiplist_map<Key, T>::find(const Key &key) const {
+  EpochDomain::Guard guard;
+  iterator it;
+  Node *node = lowerBoundNode(key);
+  if (node != nullptr && !(key < node->value.first)) it.node_ = node;
+  return it;
+}
+
+template <typename Key, typename T>
+bool concurrent_skiplist_map<Key, T>::contains(const Key &key) const {
+  EpochDomain::Guard guard;
+  Node *node = lowerBoundNode(key);
+  return node != nullptr && !(key < node->value.first);
+}
+
+template <typename Key, typename T>
+typename concurrent_skiplist_map<Key, T>::iterator
+concurrent_skiplist_map<Key, T>::lower_bound(const Key &key) const {
+  EpochDomain::Guard guard;
+  iterator it;
+  it.node_ = lowerBoundNode(key);
+  return it;
+}
+
+template <typename Key, typename T>
+typename concurrent_skiplist_map<Key, T>::iterator
+concurrent_skiplist_map<Key, T>::upper_bound(const Key &key) const {
+  iterator it = lower_bound(key);
+  if (it.node_ != nullptr && !(key < it.node_->value.first)) ++it;
+  return it;
+}
+
+template <typename Key, typename T>
+template <class... Args>
+s21::vector<std::pair<typename concurrent_skiplist_map<Key, T>::iterator, bool>>
+concurrent_skiplist_map<Key, T>::insert_many(Args &&...args) {
+  s21::vector<std::pair<iterator, bool>> vec;
+  for (const auto &arg : {args...}) {
+    vec.push_back(insert(arg));
+  }
+  return vec;
+}
+
+template <typename Key, typename T>
+typename concurrent_skiplist_map<Key, T>::Node *
+concurrent_skiplist_map<Key, T>::createNode(int level,
+                                            const value_type &value) {
+  void *memory = ::operator new(sizeof(Node) + level * sizeof(Link));
+  Node *node = nullptr;
+  try {
+    node = new (memory) Node{value, level};
+  } catch (...) {
+    ::operator delete(memory);
+    throw;
+  }
+  for (int i = 0; i < level; ++i) {
+    new (node->links() + i) Link(0);
+  }
+  return node;
+}
+
+template <typename Key, typename T>
+void concurrent_skiplist_map<Key, T>::destroyNode(void *ptr) {
+  Node *node = static_cast<Node *>(ptr);
+  node->~Node();
+  ::operator delete(ptr);
+}
+
+template <typename Key, typename T>
+int concurrent_skiplist_map<Key, T>::randomLevel() {
+  static std::atomic<std::uint64_t> seed{0x9E3779B97F4A7C15ULL};
+  thread_local std::uint64_t state =
+      seed.fetch_add(0x9E3779B97F4A7C15ULL, std::memory_order_relaxed) | 1U;
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  int level = 1;
+  for (std::uint64_t bits = state; (bits & 1U) && level < kMaxLevel;
+       bits >>= 1) {
+    ++level;
+  }
+  return level;
+}
+
+template <typename Key, typename T>
+typename concurrent_skiplist_map<Key, T>::Node *
+concurrent_skiplist_map<Key, T>::nextAlive(Node *node) {
+  Node *next = unmark(node->links()[0].load(std::memory_order_acquire));
+  while (next != nullptr) {
+    std::uintptr_t link = next->links()[0].load(std::memory_order_acquire);
+    if (!isMarked(link)) break;
+    next = unmark(link);
+  }
+  return next;
+}
+
+// Drops one share of a linked node. The last one is dropped only after both
+// the inserter and the eraser have unlinked it from every level they saw,
+// so the node is unreachable when it is retired.
+template <typename Key, typename T>
+void concurrent_skiplist_map<Key, T>::release(Node *node) {
+  if (node->shares.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    EpochDomain::instance().retire(node, &destroyNode);
+  }
+}
+
+// Fills preds/succs with the insertion window for key on every level,
+// physically unlinking marked nodes met on the way.
+template <typename Key, typename T>
+bool concurrent_skiplist_map<Key, T>::find(const Key &key, Link **preds,
+                                           Node **succs) {
+  bool restart = true;
+  while (restart) {
+    restart = false;
+    Link *pred_links = head_;
+    for (int level = kMaxLevel - 1; level >= 0 && !restart; --level) {
+      Node *curr = unmark(pred_links[level].load(std::memory_order_acquire));
+      while (curr != nullptr) {
+        std::uintptr_t succ =
+            curr->links()[level].load(std::memory_order_acquire);
+        while (isMarked(succ)) {
+          std::uintptr_t expected = pack(curr);
+          if (!pred_links[level].compare_exchange_strong(
+                  expected, pack(unmark(succ)), std::memory_order_acq_rel,
+                  std::memory_order_acquire)) {
+            restart = true;
+            break;
+          }
+          curr = unmark(succ);
+          if (curr == nullptr) break;
+          succ = curr->links()[level].load(std::memory_order_acquire);
+        }
+        if (restart || curr == nullptr) break;
+        if (!(curr->value.first < key)) break;
+        pred_links = curr->links();
+        curr = unmark(succ);
+      }
+      preds[level] = &pred_links[level];
+      succs[level] = curr;
+    }
+  }
+  return succs[0] != nullptr && !(key < succs[0]->value.first);
+}
+
+template <typename Key, typename T>
+typename concurrent_skiplist_map<Key, T>::Node *
+concurrent_skiplist_map<Key, T>::lowerBoundNode(const Key &key) const {
+  const Link *pred_links = head_;
+  Node *curr = nullptr;
+  for (int level = kMaxLevel - 1; level >= 0; --level) {
+    curr = unmark(pred_links[level].load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      std::uintptr_t succ =
+          curr->links()[level].load(std::memory_order_acquire);
+      while (isMarked(succ)) {
+        curr = unmark(succ);
+        if (curr == nullptr) break;
+        succ = curr->links()[level].load(std::memory_order_acquire);
+      }
+      if (curr == nullptr || !(curr->value.first < key)) break;
+      pred_links = curr->links();
+      curr = unmark(succ);
+    }
+  }
+  return curr;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_CONCURRENT_SKIPLIST_MAP_S21_CONCURRENT_SKIPLIST_MAP_H
@@ -0,0 +1,198 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_CONCURRENT_SKIPLIST_MAP_S21_EPOCH_H
+#define CPP2_S21_CONTAINERS_2_SRC_CONCURRENT_SKIPLIST_MAP_S21_EPOCH_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace s21 {
+
+// Epoch-based memory reclamation shared by the lock-free containers.
+// A thread pins the current epoch with a Guard before touching shared nodes;
+// unlinked nodes are handed to retire() and freed once every pinned thread
+// has moved at least two epochs past the moment of retirement.
+class EpochDomain {
+ public:
+  using deleter_type = void (*)(void *);
+
+  class Guard;
+
+  static EpochDomain &instance() {
+    static EpochDomain domain;
+    return domain;
+  }
+
+  EpochDomain(const EpochDomain &) = delete;
+  EpochDomain &operator=(const EpochDomain &) = delete;
+
+  ~EpochDomain() {
+    for (Record *r = records_.load(std::memory_order_acquire); r != nullptr;) {
+      Record *next = r->next;
+      freeAll(r->retired);
+      delete r;
+      r = next;
+    }
+    freeAll(orphans_);
+  }
+
+  void retire(void *ptr, deleter_type deleter) {
+    Record *record = localRecord();
+    record->retired.push_back(
+        {ptr, deleter, global_epoch_.load(std::memory_order_relaxed)});
+    if (++record->retire_count % kCollectPeriod == 0) {
+      tryAdvance();
+      collect(record->retired);
+      collectOrphans();
+    }
+  }
+
+ private:
+  static constexpr unsigned kCollectPeriod = 64;
+
+  struct Retired {
+    void *ptr;
+    deleter_type deleter;
+    std::uint64_t epoch;
+  };
+
+  struct Record {
+    std::atomic<std::uint64_t> epoch{0};
+    std::atomic<bool> in_use{false};
+    Record *next = nullptr;
+    unsigned nesting = 0;
+    unsigned retire_count = 0;
+    std::vector<Retired> retired;
+  };
+
+  class Handle {
+   public:
+    explicit Handle(EpochDomain &domain)
+        : domain_(domain), record_(domain.acquireRecord()) {}
+    ~Handle() { domain_.releaseRecord(record_); }
+
+    Record *record() const { return record_; }
+
+   private:
+    EpochDomain &domain_;
+    Record *record_;
+  };
+
+  EpochDomain() : global_epoch_(1), records_(nullptr) {}
+
+  Record *localRecord() {
+    thread_local Handle handle(*this);
+    return handle.record();
+  }
+
+  void pin(Record *record) {
+    if (record->nesting++ == 0) {
+      record->epoch.exchange(global_epoch_.load(std::memory_order_seq_cst),
+                             std::memory_order_seq_cst);
+    }
+  }
+
+  void unpin(Record *record) {
+    if (--record->nesting == 0) {
+      record->epoch.store(0, std::memory_order_release);
+    }
+  }
+
+  void tryAdvance() {
+    std::uint64_t global = global_epoch_.load(std::memory_order_seq_cst);
+    for (Record *r = records_.load(std::memory_order_acquire); r != nullptr;
+         r = r->next) {
+      std::uint64_t local = r->epoch.load(std::memory_order_seq_cst);
+      if (local != 0 && local != global) return;
+    }
+    global_epoch_.compare_exchange_strong(global, global + 1,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed);
+  }
+
+  void collect(std::vector<Retired> &retired) {
+    std::uint64_t global = global_epoch_.load(std::memory_order_acquire);
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < retired.size(); ++i) {
+      if (global - retired[i].epoch >= 2) {
+        retired[i].deleter(retired[i].ptr);
+      } else {
+        retired[kept++] = retired[i];
+      }
+    }
+    retired.resize(kept);
+  }
+
+  void collectOrphans() {
+    std::unique_lock<std::mutex> lock(orphans_mutex_, std::try_to_lock);
+    if (lock.owns_lock() && !orphans_.empty()) collect(orphans_);
+  }
+
+  static void freeAll(std::vector<Retired> &retired) {
+    for (auto &item : retired) item.deleter(item.ptr);
+    retired.clear();
+  }
+
+  Record *acquireRecord() {
+    for (Record *r = records_.load(std::memory_order_acquire); r != nullptr;
+         r = r->next) {
+      bool expected = false;
+      if (!r->in_use.load(std::memory_order_relaxed) &&
+          r->in_use.compare_exchange_strong(expected, true,
+                                            std::memory_order_acquire)) {
+        return r;
+      }
+    }
+    Record *record = new Record;
+    record->in_use.store(true, std::memory_order_relaxed);
+    Record *head = records_.load(std::memory_order_relaxed);
+    do {
+      record->next = head;
+    } while (!records_.compare_exchange_weak(head, record,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+    return record;
+  }
+
+  void releaseRecord(Record *record) {
+    if (!record->retired.empty()) {
+      std::lock_guard<std::mutex> lock(orphans_mutex_);
+      orphans_.insert(orphans_.end(), record->retired.begin(),
+                      record->retired.end());
+      record->retired.clear();
+    }
+    record->nesting = 0;
+    record->retire_count = 0;
+    record->epoch.store(0, std::memory_order_relaxed);
+    record->in_use.store(false, std::memory_order_release);
+  }
+
+  std::atomic<std::uint64_t> global_epoch_;
+  std::atomic<Record *> records_;
+  std::mutex orphans_mutex_;
+  std::vector<Retired> orphans_;
+};
+
+// Pins the calling thread to the current epoch for the guard's lifetime.
+// Guards nest and may be copied, but never handed to another thread.
+class EpochDomain::Guard {
+ public:
+  Guard() : record_(EpochDomain::instance().localRecord()) {
+    EpochDomain::instance().pin(record_);
+  }
+
+  Guard(const Guard &other) : record_(other.record_) {
+    EpochDomain::instance().pin(record_);
+  }
+
+  Guard &operator=(const Guard &) { return *this; }
+
+  ~Guard() { EpochDomain::instance().unpin(record_); }
+
+ private:
+  Record *record_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_CONCURRENT_SKIPLIST_MAP_S21_EPOCH_H
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_concurrent_skiplist_map.h"
+
+TEST(concurrent_skiplist_map, ConstructorDefault) {
+  s21::concurrent_skiplist_map<int, int> my_map;
+  std::map<int, int> map;
+  EXPECT_EQ(my_map.empty(), map.empty());
+  EXPECT_EQ(my_map.size(), map.size());
+  EXPECT_TRUE(my_map.begin() == my_map.end());
+}
+
+TEST(concurrent_skiplist_map, ConstructorInitializer) {
+  s21::concurrent_skiplist_map<int, int> my_map = {
+      {4, 5}, {2, 3}, {1, 2}, {3, 4}};
+  std::map<int, int> map = {{4, 5}, {2, 3}, {1, 2}, {3, 4}};
+  EXPECT_EQ(my_map.size(), map.size());
+  auto my_it = my_map.begin();
+  auto it = map.begin();
+  for (; my_it != my_map.end(); ++my_it, ++it) {
+    EXPECT_EQ((*it).first, (*my_it).first);
+    EXPECT_EQ((*it).second, (*my_it).second);
+  }
+  EXPECT_TRUE(it == map.end());
+}
+
+TEST(concurrent_skiplist_map, Insert) {
+  s21::concurrent_skiplist_map<int, std::string> my_map;
+  auto pr = my_map.insert(3, "three");
+  EXPECT_TRUE(pr.second);
+  EXPECT_EQ((*pr.first).second, "three");
+  pr = my_map.insert({3, "other"});
+  EXPECT_FALSE(pr.second);
+  EXPECT_EQ((*pr.first).second, "three");
+  EXPECT_EQ(my_map.size(), 1U);
+}
+
+TEST(concurrent_skiplist_map, Erase) {
+  s21::concurrent_skiplist_map<int, int> my_map = {
+      {1, 1}, {2, 2}, {3, 3}, {4, 4}};
+  EXPECT_EQ(my_map.erase(2), 1U);
+  EXPECT_EQ(my_map.erase(2), 0U);
+  my_map.erase(my_map.find(4));
+  EXPECT_FALSE(my_map.contains(2));
+  EXPECT_FALSE(my_map.contains(4));
+  EXPECT_TRUE(my_map.contains(1));
+  EXPECT_TRUE(my_map.contains(3));
+  EXPECT_EQ(my_map.size(), 2U);
+}
+
+TEST(concurrent_skiplist_map, FindAndBounds) {
+  s21::concurrent_skiplist_map<int, int> my_map = {
+      {10, 1}, {20, 2}, {30, 3}};
+  std::map<int, int> map = {{10, 1}, {20, 2}, {30, 3}};
+  EXPECT_TRUE(my_map.find(15) == my_map.end());
+  EXPECT_EQ((*my_map.find(20)).second, 2);
+  for (int key : {5, 10, 15, 20, 25, 30}) {
+    EXPECT_EQ((*my_map.lower_bound(key)).first, (*map.lower_bound(key)).first);
+  }
+  for (int key : {5, 10, 15, 20, 25}) {
+    EXPECT_EQ((*my_map.upper_bound(key)).first, (*map.upper_bound(key)).first);
+  }
+  EXPECT_TRUE(my_map.lower_bound(31) == my_map.end());
+  EXPECT_TRUE(my_map.upper_bound(30) == my_map.end());
+}
+
+TEST(concurrent_skiplist_map, IteratorStaysValidAfterErase) {
+  s21::concurrent_skiplist_map<int, int> my_map = {{1, 1}, {2, 2}, {3, 3}};
+  auto it = my_map.find(2);
+  my_map.erase(2);
+  EXPECT_EQ((*it).second, 2);
+  ++it;
+  EXPECT_EQ((*it).first, 3);
+}
+
+TEST(concurrent_skiplist_map, Clear) {
+  s21::concurrent_skiplist_map<int, int> my_map = {{1, 1}, {2, 2}};
+  my_map.clear();
+  EXPECT_TRUE(my_map.empty());
+  my_map.insert(5, 5);
+  EXPECT_EQ(my_map.size(), 1U);
+}
+
+TEST(concurrent_skiplist_map, InsertMany) {
+  s21::concurrent_skiplist_map<int, int> my_map;
+  auto res = my_map.insert_many(std::make_pair(1, 1), std::make_pair(2, 2),
+                                std::make_pair(1, 3));
+  EXPECT_EQ(res.size(), 3U);
+  EXPECT_TRUE(res[0].second);
+  EXPECT_TRUE(res[1].second);
+  EXPECT_FALSE(res[2].second);
+  EXPECT_EQ(my_map.size(), 2U);
+}
+
+TEST(concurrent_skiplist_map, ConcurrentInsertDisjoint) {
+  s21::concurrent_skiplist_map<int, int> my_map;
+  const int threads = 4;
+  const int per_thread = 5000;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&my_map, t] {
+      for (int i = 0; i < per_thread; ++i) {
+        my_map.insert(i * threads + t, t);
+      }
+    });
+  }
+  for (auto &w : workers) w.join();
+
+  EXPECT_EQ(my_map.size(), static_cast<size_t>(threads * per_thread));
+  int expected = 0;
+  for (auto it = my_map.begin(); it != my_map.end(); ++it, ++expected) {
+    EXPECT_EQ((*it).first, expected);
+  }
+  EXPECT_EQ(expected, threads * per_thread);
+}
+
+TEST(concurrent_skiplist_map, ConcurrentInsertEraseSameKeys) {
+  s21::concurrent_skiplist_map<int, int> my_map;
+  const int keys = 512;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; ++t) {
+    workers.emplace_back([&my_map, t] {
+      for (int round = 0; round < 20; ++round) {
+        for (int k = 0; k < keys; ++k) {
+          if ((k + t + round) % 2 == 0) {
+            my_map.insert(k, t);
+          } else {
+            my_map.erase(k);
+          }
+          my_map.contains(k);
+        }
+      }
+    });
+  }
+  for (auto &w : workers) w.join();
+
+  size_t counted = 0;
+  int previous = -1;
+  for (auto it = my_map.begin(); it != my_map.end(); ++it, ++counted) {
+    EXPECT_LT(previous, (*it).first);
+    previous = (*it).first;
+  }
+  EXPECT_EQ(counted, my_map.size());
+}
+
+TEST(concurrent_skiplist_map, ReadersNeverSeeReclaimedNodes) {
+  // A few hot keys are inserted and erased at once, so erases often land
+  // while the inserter is still linking the tower; the readers walk every
+  // level through lower_bound and level 0 through iteration meanwhile.
+  s21::concurrent_skiplist_map<int, std::string> my_map;
+  const int keys = 8;
+  std::atomic<bool> done{false};
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; ++t) {
+    workers.emplace_back([&my_map, t] {
+      for (int round = 0; round < 20000; ++round) {
+        int key = (round + t) % keys;
+        if ((round + t) % 2 == 0) {
+          my_map.insert(key, std::string(32, static_cast<char>('a' + t)));
+        } else {
+          my_map.erase(key);
+        }
+      }
+    });
+  }
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 2; ++r) {
+    readers.emplace_back([&my_map, &done] {
+      while (!done.load(std::memory_order_relaxed)) {
+        for (int key = 0; key <= keys; ++key) {
+          auto it = my_map.lower_bound(key);
+          if (it != my_map.end()) {
+            EXPECT_EQ(it->second.size(), 32U);
+          }
+        }
+        for (auto it = my_map.begin(); it != my_map.end(); ++it) {
+          EXPECT_EQ(it->second.size(), 32U);
+        }
+      }
+    });
+  }
+  for (auto &w : workers) w.join();
+  done.store(true, std::memory_order_relaxed);
+  for (auto &r : readers) r.join();
+
+  size_t counted = 0;
+  for (auto it = my_map.begin(); it != my_map.end(); ++it) ++counted;
+  EXPECT_EQ(counted, my_map.size());
+}
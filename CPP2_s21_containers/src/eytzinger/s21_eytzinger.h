@@ -0,0 +1,152 @@
+#ifndef CPP_2_S21_CONTAINERS_2_SRC_EYTZINGER_S21_EYTZINGER_H
+#define CPP_2_S21_CONTAINERS_2_SRC_EYTZINGER_S21_EYTZINGER_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Sorted, unique keys laid out in Eytzinger (breadth-first) order: the
+// children of slot k are slots 2k and 2k + 1, the root is slot 1 and slot 0
+// is a spare. The array starts on a cache line, so the 64 / sizeof(Key)
+// descendants a few levels below k share one line and can be prefetched
+// long before the search gets there.
+template <typename Key>
+class EytzingerIndex {
+ public:
+  using size_type = std::size_t;
+
+  EytzingerIndex() : keys_(nullptr), size_(0) {}
+
+  // Takes count keys from an input iterator yielding them in ascending order.
+  template <typename InputIt>
+  EytzingerIndex(InputIt first, size_type count)
+      : keys_(nullptr), size_(count) {
+    if (size_ == 0) return;
+    keys_ = allocate(size_);
+    for (size_type slot = this->first(); slot != 0; slot = next(slot)) {
+      new (keys_ + slot) Key(*first);
+      ++first;
+    }
+    new (keys_) Key(keys_[1]);
+  }
+
+  EytzingerIndex(const EytzingerIndex &other)
+      : keys_(nullptr), size_(other.size_) {
+    if (size_ == 0) return;
+    keys_ = allocate(size_);
+    for (size_type slot = 0; slot <= size_; ++slot) {
+      new (keys_ + slot) Key(other.keys_[slot]);
+    }
+  }
+
+  EytzingerIndex(EytzingerIndex &&other)
+      : keys_(other.keys_), size_(other.size_) {
+    other.keys_ = nullptr;
+    other.size_ = 0;
+  }
+
+  EytzingerIndex &operator=(EytzingerIndex other) {
+    std::swap(keys_, other.keys_);
+    std::swap(size_, other.size_);
+    return *this;
+  }
+
+  ~EytzingerIndex() {
+    if (keys_ == nullptr) return;
+    for (size_type slot = 0; slot <= size_; ++slot) keys_[slot].~Key();
+    ::operator delete(keys_, std::align_val_t(kCacheLine));
+  }
+
+  size_type size() const { return size_; }
+
+  const Key &key(size_type slot) const { return keys_[slot]; }
+
+  // Slot of the first key that is not less than key, or 0 if there is none.
+  // The loop has no data-dependent branch: each step only picks a child.
+  size_type lowerBound(const Key &key) const {
+    size_type slot = 1;
+    while (slot <= size_) {
+      __builtin_prefetch(keys_ + slot * kKeysPerLine);
+      slot = 2 * slot + (keys_[slot] < key);
+    }
+    return up(slot);
+  }
+
+  // Slot holding key, or 0 if it is absent.
+  size_type find(const Key &key) const {
+    size_type slot = lowerBound(key);
+    return slot != 0 && !(key < keys_[slot]) ? slot : 0;
+  }
+
+  // find() for count keys at once. The searches advance level by level in
+  // groups of kBatch, so their cache misses overlap instead of queueing.
+  void findMany(const Key *keys, size_type count, size_type *slots) const {
+    size_type levels = 0;
+    for (size_type n = size_; n != 0; n >>= 1) ++levels;
+    for (size_type base = 0; base < count; base += kBatch) {
+      size_type lanes = count - base < kBatch ? count - base : kBatch;
+      size_type slot[kBatch];
+      for (size_type lane = 0; lane < lanes; ++lane) slot[lane] = 1;
+      for (size_type level = 0; level < levels; ++level) {
+        for (size_type lane = 0; lane < lanes; ++lane) {
+          size_type current = slot[lane];
+          bool inside = current <= size_;
+          __builtin_prefetch(keys_ + (inside ? current : 0) * kKeysPerLine);
+          size_type child =
+              2 * current + (keys_[inside ? current : 0] < keys[base + lane]);
+          slot[lane] = inside ? child : current;
+        }
+      }
+      for (size_type lane = 0; lane < lanes; ++lane) {
+        size_type found = up(slot[lane]);
+        slots[base + lane] =
+            found != 0 && !(keys[base + lane] < keys_[found]) ? found : 0;
+      }
+    }
+  }
+
+  // In-order traversal: first() is the smallest key, next() returns 0 after
+  // the largest one.
+  size_type first() const {
+    if (size_ == 0) return 0;
+    size_type slot = 1;
+    while (2 * slot <= size_) slot *= 2;
+    return slot;
+  }
+
+  size_type next(size_type slot) const {
+    if (2 * slot + 1 <= size_) {
+      slot = 2 * slot + 1;
+      while (2 * slot <= size_) slot *= 2;
+      return slot;
+    }
+    return up(slot);
+  }
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+  static constexpr size_type kKeysPerLine =
+      sizeof(Key) < kCacheLine ? kCacheLine / sizeof(Key) : 1;
+  static constexpr size_type kBatch = 16;
+
+  static Key *allocate(size_type size) {
+    return static_cast<Key *>(::operator new(
+        (size + 1) * sizeof(Key), std::align_val_t(kCacheLine)));
+  }
+
+  // Leaves every subtree that slot finished on the right side of, then the
+  // parent it entered from the left: the in-order successor.
+  static size_type up(size_type slot) {
+    return slot >> (__builtin_ctzll(~static_cast<unsigned long long>(slot)) +
+                    1);
+  }
+
+  Key *keys_;
+  size_type size_;
+};
+
+}  // namespace s21
+
+#endif  // CPP_2_S21_CONTAINERS_2_SRC_EYTZINGER_S21_EYTZINGER_H
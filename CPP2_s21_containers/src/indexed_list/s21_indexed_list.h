@@ -0,0 +1,424 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_INDEXED_LIST_S21_INDEXED_LIST_H
+#define CPP2_S21_CONTAINERS_2_SRC_INDEXED_LIST_S21_INDEXED_LIST_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "../list/s21_list.h"
+
+namespace s21 {
+
+// Sequence with O(log n) expected positional access, insert and erase: an
+// indexable skip list. Level 0 is the same NodeBase ring s21::list uses, so
+// iteration is the list Iterator and costs O(1) per step. Every link above
+// level 0 records its width (how many level-0 steps it spans) and is doubly
+// linked, which lets an iterator find its index and its predecessors by
+// walking up and to the left.
+//
+// Iterators stay valid until their element is erased.
+template <typename T>
+class indexed_list {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = Iterator<indexed_list>;
+  using const_iterator = const Iterator<indexed_list>;
+  using size_type = size_t;
+
+  indexed_list() : size_(0U), top_(0), random_(0x9E3779B97F4A7C15ULL) {}
+
+  explicit indexed_list(size_type n) : indexed_list() {
+    for (size_type i = 0; i < n; ++i) emplace_back();
+  }
+
+  indexed_list(std::initializer_list<value_type> const &items)
+      : indexed_list() {
+    for (const auto &item : items) push_back(item);
+  }
+
+  indexed_list(const indexed_list &other) : indexed_list() {
+    for (const auto &item : other) push_back(item);
+  }
+
+  indexed_list(indexed_list &&other) noexcept : indexed_list() {
+    takeNodes(other);
+  }
+
+  ~indexed_list() { clear(); }
+
+  indexed_list &operator=(const indexed_list &other) {
+    if (this != &other) {
+      clear();
+      for (const auto &item : other) push_back(item);
+    }
+    return *this;
+  }
+
+  indexed_list &operator=(indexed_list &&other) noexcept {
+    if (this != &other) {
+      clear();
+      takeNodes(other);
+    }
+    return *this;
+  }
+
+  bool operator==(const indexed_list &other) const {
+    if (size_ != other.size_) return false;
+    iterator it = other.begin();
+    for (const auto &item : *this) {
+      if (!(item == *it++)) return false;
+    }
+    return true;
+  }
+
+  bool operator!=(const indexed_list &other) const {
+    return !(*this == other);
+  }
+
+  const_reference front() const {
+    if (size_ == 0) throw std::out_of_range("list is empty.");
+    return valueOf(fake_.pNext);
+  }
+
+  const_reference back() const {
+    if (size_ == 0) throw std::out_of_range("list is empty.");
+    return valueOf(fake_.pPrev);
+  }
+
+  reference operator[](size_type index) { return valueOf(nodeAt(index)); }
+  const_reference operator[](size_type index) const {
+    return valueOf(nodeAt(index));
+  }
+
+  reference at(size_type index) {
+    if (index >= size_) throw std::out_of_range("index is out of range.");
+    return (*this)[index];
+  }
+
+  const_reference at(size_type index) const {
+    if (index >= size_) throw std::out_of_range("index is out of range.");
+    return (*this)[index];
+  }
+
+  iterator begin() { return iterator(fake_.pNext); }
+  const_iterator begin() const { return iterator(fake_.pNext); }
+  const_iterator cbegin() const { return begin(); }
+
+  iterator end() { return iterator(&fake_); }
+  const_iterator end() const { return iterator(sentinel()); }
+  const_iterator cend() const { return end(); }
+
+  // Iterator to the element at index, or end() for index == size().
+  iterator iterator_at(size_type index) {
+    return index >= size_ ? end() : iterator(nodeAt(index));
+  }
+
+  // Position of pos in the sequence; size() for end().
+  size_type index_of(const_iterator pos) const {
+    NodeBase *current = pos.get_node();
+    size_type distance = 0;
+    int level = 0;
+    while (current != &fake_) {
+      int height = heightOf(current);
+      if (height > level) level = height;
+      NodeBase *prev = prevAt(current, level);
+      distance += widthAt(prev, level);
+      current = prev;
+    }
+    return distance == 0 ? size_ : distance - 1;
+  }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(SkipNode);
+  }
+
+  void clear() {
+    NodeBase *current = fake_.pNext;
+    while (current != &fake_) {
+      NodeBase *next = current->pNext;
+      destroyNode(current);
+      current = next;
+    }
+    fake_.pNext = fake_.pPrev = &fake_;
+    for (int level = 0; level < kMaxLevel; ++level) head_[level] = Link();
+    top_ = 0;
+    size_ = 0;
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+
+  iterator insert_at(size_type index, const_reference value) {
+    return emplace(iterator_at(index), value);
+  }
+
+  iterator insert_at(size_type index, value_type &&value) {
+    return emplace(iterator_at(index), std::move(value));
+  }
+
+  iterator erase(iterator pos);
+
+  iterator erase_at(size_type index) { return erase(iterator_at(index)); }
+
+  void push_back(const_reference value) { emplace(end(), value); }
+  void push_back(value_type &&value) { emplace(end(), std::move(value)); }
+
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  void push_front(const_reference value) { emplace(begin(), value); }
+  void push_front(value_type &&value) { emplace(begin(), std::move(value)); }
+
+  template <class... Args>
+  reference emplace_front(Args &&...args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    if (size_ > 0) erase(iterator(fake_.pPrev));
+  }
+
+  void pop_front() {
+    if (size_ > 0) erase(iterator(fake_.pNext));
+  }
+
+  void swap(indexed_list &other) {
+    if (this != &other) {
+      indexed_list tmp;
+      tmp.takeNodes(*this);
+      takeNodes(other);
+      other.takeNodes(tmp);
+      std::swap(random_, other.random_);
+    }
+  }
+
+ private:
+  friend class Iterator<indexed_list>;
+  friend class ConstIterator<indexed_list>;
+
+  // With a 1/4 promotion chance, 32 levels cover any size_type.
+  static constexpr int kMaxLevel = 32;
+
+  // A link on levels 1 and up; width is counted in level-0 steps and is
+  // meaningless while next is null.
+  struct Link {
+    NodeBase *next = nullptr;
+    NodeBase *prev = nullptr;
+    size_type width = 0;
+  };
+
+  // The tower of height links for levels 1..height follows the node in the
+  // same allocation.
+  struct SkipNode : NodeBase {
+    template <class... Args>
+    explicit SkipNode(int height, Args &&...args)
+        : data(std::forward<Args>(args)...), height(height) {}
+
+    Link *tower() {
+      return reinterpret_cast<Link *>(reinterpret_cast<char *>(this) +
+                                      sizeof(SkipNode));
+    }
+
+    value_type data;
+    int height;
+  };
+
+  static SkipNode *node(NodeBase *base) {
+    return static_cast<SkipNode *>(base);
+  }
+
+  static reference valueOf(NodeBase *base) { return node(base)->data; }
+
+  NodeBase *sentinel() const { return const_cast<NodeBase *>(&fake_); }
+
+  int heightOf(NodeBase *base) const {
+    return base == &fake_ ? kMaxLevel : node(base)->height;
+  }
+
+  Link &linkAt(NodeBase *base, int level) const {
+    Link *tower = base == &fake_ ? const_cast<Link *>(head_)
+                                 : node(base)->tower();
+    return tower[level - 1];
+  }
+
+  NodeBase *prevAt(NodeBase *base, int level) const {
+    return level == 0 ? base->pPrev : linkAt(base, level).prev;
+  }
+
+  size_type widthAt(NodeBase *base, int level) const {
+    return level == 0 ? 1 : linkAt(base, level).width;
+  }
+
+  // Top-down search by widths; the head sits at position 0.
+  NodeBase *nodeAt(size_type index) const {
+    NodeBase *current = sentinel();
+    size_type position = 0;
+    size_type target = index + 1;
+    for (int level = top_; level > 0; --level) {
+      Link *link = &linkAt(current, level);
+      while (link->next != nullptr && position + link->width <= target) {
+        position += link->width;
+        current = link->next;
+        link = &linkAt(current, level);
+      }
+    }
+    for (; position < target; ++position) current = current->pNext;
+    return current;
+  }
+
+  int randomHeight() {
+    random_ ^= random_ << 13;
+    random_ ^= random_ >> 7;
+    random_ ^= random_ << 17;
+    return __builtin_ctzll(random_ | (1ULL << 62)) / 2;
+  }
+
+  // For level 1..levels, the last node strictly before pos that reaches
+  // that level, and its distance to pos.
+  void predecessors(NodeBase *pos, int levels, NodeBase **update,
+                    size_type *distance) const {
+    NodeBase *current = pos->pPrev;
+    size_type steps = 1;
+    for (int level = 1; level <= levels; ++level) {
+      while (heightOf(current) < level) {
+        NodeBase *prev = prevAt(current, level - 1);
+        steps += widthAt(prev, level - 1);
+        current = prev;
+      }
+      update[level] = current;
+      distance[level] = steps;
+    }
+  }
+
+  void destroyNode(NodeBase *base) {
+    SkipNode *target = node(base);
+    target->~SkipNode();
+    ::operator delete(target);
+  }
+
+  // Moves every node of other into this list, which must be empty.
+  void takeNodes(indexed_list &other) {
+    if (other.size_ == 0) return;
+    fake_.pNext = other.fake_.pNext;
+    fake_.pPrev = other.fake_.pPrev;
+    fake_.pNext->pPrev = fake_.pPrev->pNext = &fake_;
+    for (int level = 1; level <= other.top_; ++level) {
+      head_[level - 1] = other.head_[level - 1];
+      linkAt(head_[level - 1].next, level).prev = &fake_;
+    }
+    top_ = other.top_;
+    size_ = other.size_;
+    other.fake_.pNext = other.fake_.pPrev = &other.fake_;
+    for (int level = 0; level < kMaxLevel; ++level) other.head_[level] = Link();
+    other.top_ = 0;
+    other.size_ = 0;
+  }
+
+  size_type size_;
+  int top_;
+  std::uint64_t random_;
+  NodeBase fake_;
+  Link head_[kMaxLevel];
+};
+
+template <typename T>
+template <class... Args>
+typename indexed_list<T>::iterator indexed_list<T>::emplace(
+    const_iterator pos, Args &&...args) {
+  int height = randomHeight();
+  void *raw = ::operator new(sizeof(SkipNode) + height * sizeof(Link));
+  SkipNode *fresh;
+  try {
+    fresh = new (raw) SkipNode(height, std::forward<Args>(args)...);
+  } catch (...) {
+    ::operator delete(raw);
+    throw;
+  }
+  for (int level = 0; level < height; ++level) {
+    new (fresh->tower() + level) Link;
+  }
+
+  NodeBase *at = pos.get_node();
+  int levels = height > top_ ? height : top_;
+  NodeBase *update[kMaxLevel + 1];
+  size_type distance[kMaxLevel + 1];
+  predecessors(at, levels, update, distance);
+  for (int level = 1; level <= levels; ++level) {
+    Link &before = linkAt(update[level], level);
+    if (level <= height) {
+      Link &link = fresh->tower()[level - 1];
+      link.next = before.next;
+      link.prev = update[level];
+      if (before.next != nullptr) {
+        link.width = before.width + 1 - distance[level];
+        linkAt(before.next, level).prev = fresh;
+      }
+      before.next = fresh;
+      before.width = distance[level];
+    } else if (before.next != nullptr) {
+      ++before.width;
+    }
+  }
+  if (height > top_) top_ = height;
+
+  fresh->pNext = at;
+  fresh->pPrev = at->pPrev;
+  at->pPrev->pNext = fresh;
+  at->pPrev = fresh;
+  ++size_;
+  return iterator(fresh);
+}
+
+template <typename T>
+typename indexed_list<T>::iterator indexed_list<T>::erase(iterator pos) {
+  NodeBase *target = pos.get_node();
+  if (size_ == 0 || target == &fake_) return end();
+  int height = heightOf(target);
+  for (int level = 1; level <= height; ++level) {
+    Link &link = linkAt(target, level);
+    Link &before = linkAt(link.prev, level);
+    before.next = link.next;
+    if (link.next != nullptr) {
+      before.width += link.width - 1;
+      linkAt(link.next, level).prev = link.prev;
+    }
+  }
+  if (height < top_) {
+    NodeBase *update[kMaxLevel + 1];
+    size_type distance[kMaxLevel + 1];
+    predecessors(target, top_, update, distance);
+    for (int level = height + 1; level <= top_; ++level) {
+      Link &before = linkAt(update[level], level);
+      if (before.next != nullptr) --before.width;
+    }
+  }
+  while (top_ > 0 && head_[top_ - 1].next == nullptr) --top_;
+
+  NodeBase *next = target->pNext;
+  target->pPrev->pNext = next;
+  next->pPrev = target->pPrev;
+  destroyNode(target);
+  --size_;
+  return iterator(next);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_INDEXED_LIST_S21_INDEXED_LIST_H
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "s21_indexed_list.h"
+
+namespace {
+
+template <typename T>
+void expectSameContents(const s21::indexed_list<T> &my_list,
+                        const std::vector<T> &expected) {
+  ASSERT_EQ(my_list.size(), expected.size());
+  std::size_t i = 0;
+  for (const auto &item : my_list) EXPECT_EQ(item, expected[i++]);
+  for (i = 0; i < expected.size(); ++i) EXPECT_EQ(my_list[i], expected[i]);
+}
+
+}  // namespace
+
+TEST(indexed_list, ConstructorDefault) {
+  s21::indexed_list<int> my_list;
+  EXPECT_TRUE(my_list.empty());
+  EXPECT_EQ(my_list.size(), 0U);
+  EXPECT_TRUE(my_list.begin() == my_list.end());
+  EXPECT_THROW(my_list.front(), std::out_of_range);
+  EXPECT_THROW(my_list.back(), std::out_of_range);
+  EXPECT_THROW(my_list.at(0), std::out_of_range);
+}
+
+TEST(indexed_list, ConstructorSizeListCopyAndMove) {
+  s21::indexed_list<int> sized(5);
+  expectSameContents(sized, std::vector<int>(5));
+  s21::indexed_list<int> items{1, 2, 3, 4, 5, 6, 7};
+  s21::indexed_list<int> copy(items);
+  EXPECT_TRUE(copy == items);
+  s21::indexed_list<int> moved(std::move(copy));
+  EXPECT_TRUE(moved == items);
+  EXPECT_TRUE(copy.empty());
+  moved.insert_at(3, 40);
+  EXPECT_EQ(moved[3], 40);
+  EXPECT_TRUE(moved != items);
+  copy = std::move(moved);
+  expectSameContents(copy, std::vector<int>{1, 2, 3, 40, 4, 5, 6, 7});
+  copy = items;
+  EXPECT_TRUE(copy == items);
+}
+
+TEST(indexed_list, PositionalInsertAndErase) {
+  s21::indexed_list<std::string> my_list;
+  auto it = my_list.insert_at(0, "b");
+  EXPECT_EQ(*it, "b");
+  my_list.insert_at(0, "a");
+  my_list.insert_at(2, "d");
+  my_list.insert_at(2, "c");
+  expectSameContents(my_list, std::vector<std::string>{"a", "b", "c", "d"});
+  it = my_list.erase_at(1);
+  EXPECT_EQ(*it, "c");
+  EXPECT_TRUE(my_list.erase_at(2) == my_list.end());
+  expectSameContents(my_list, std::vector<std::string>{"a", "c"});
+  my_list.at(1) = "z";
+  EXPECT_EQ(my_list.back(), "z");
+  EXPECT_THROW(my_list.at(2), std::out_of_range);
+}
+
+TEST(indexed_list, IteratorsAndIndexOf) {
+  s21::indexed_list<int> my_list;
+  for (int i = 0; i < 200; ++i) my_list.push_back(i);
+  for (std::size_t i = 0; i < my_list.size(); ++i) {
+    EXPECT_EQ(my_list.index_of(my_list.iterator_at(i)), i);
+  }
+  EXPECT_EQ(my_list.index_of(my_list.end()), 200U);
+  int expected = 199;
+  auto it = my_list.end();
+  do {
+    --it;
+    EXPECT_EQ(*it, expected--);
+  } while (it != my_list.begin());
+  auto kept = my_list.iterator_at(150);
+  my_list.erase_at(10);
+  my_list.insert_at(0, -1);
+  my_list.insert_at(0, -2);
+  EXPECT_EQ(*kept, 150);
+  EXPECT_EQ(my_list.index_of(kept), 151U);
+}
+
+TEST(indexed_list, PushPopAndEmplace) {
+  s21::indexed_list<std::unique_ptr<int>> my_list;
+  my_list.push_back(std::make_unique<int>(2));
+  my_list.push_front(std::make_unique<int>(1));
+  EXPECT_EQ(*my_list.emplace_back(new int(3)), 3);
+  EXPECT_EQ(*my_list.emplace_front(new int(0)), 0);
+  auto it = my_list.emplace(my_list.iterator_at(2), new int(9));
+  EXPECT_EQ(**it, 9);
+  EXPECT_EQ(my_list.index_of(it), 2U);
+  my_list.pop_front();
+  my_list.pop_back();
+  ASSERT_EQ(my_list.size(), 3U);
+  EXPECT_EQ(*my_list[0], 1);
+  EXPECT_EQ(*my_list[1], 9);
+  EXPECT_EQ(*my_list[2], 2);
+  my_list.clear();
+  my_list.pop_back();
+  EXPECT_TRUE(my_list.empty());
+}
+
+TEST(indexed_list, SwapKeepsBothUsable) {
+  s21::indexed_list<int> first;
+  for (int i = 0; i < 100; ++i) first.push_back(i);
+  s21::indexed_list<int> second{7};
+  first.swap(second);
+  expectSameContents(first, std::vector<int>{7});
+  EXPECT_EQ(second.size(), 100U);
+  second.erase_at(0);
+  second.insert_at(50, -1);
+  EXPECT_EQ(second[0], 1);
+  EXPECT_EQ(second[50], -1);
+  EXPECT_EQ(second[51], 51);
+  EXPECT_EQ(second.index_of(--second.end()), 99U);
+}
+
+TEST(indexed_list, RandomOpsMatchVector) {
+  s21::indexed_list<int> my_list;
+  std::vector<int> expected;
+  unsigned state = 11;
+  for (int step = 0; step < 20000; ++step) {
+    state = state * 1103515245U + 12345U;
+    unsigned op = (state >> 16) % 8;
+    std::size_t at = (state >> 4) % (expected.size() + 1);
+    if (op < 4 || expected.empty()) {
+      my_list.insert_at(at, step);
+      expected.insert(expected.begin() + at, step);
+    } else if (op < 7) {
+      if (at == expected.size()) --at;
+      my_list.erase_at(at);
+      expected.erase(expected.begin() + at);
+    } else {
+      if (at == expected.size()) --at;
+      ASSERT_EQ(my_list[at], expected[at]);
+      ASSERT_EQ(my_list.index_of(my_list.iterator_at(at)), at);
+    }
+  }
+  expectSameContents(my_list, expected);
+}
@@ -0,0 +1,187 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_INTRUSIVE_LIST_S21_INTRUSIVE_LIST_H
+#define CPP2_S21_CONTAINERS_2_SRC_INTRUSIVE_LIST_S21_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+#include "../list/s21_list.h"
+
+namespace s21 {
+
+// Base class that lets an object sit in an intrusive_list<T, Tag>. An object
+// can be in as many lists at once as it has hooks with distinct tags. Copies
+// of an object start out unlinked.
+template <class Tag = void>
+class intrusive_list_hook : public NodeBase {
+ public:
+  intrusive_list_hook() = default;
+  intrusive_list_hook(const intrusive_list_hook &) : NodeBase() {}
+  intrusive_list_hook &operator=(const intrusive_list_hook &) { return *this; }
+  ~intrusive_list_hook() = default;
+
+  bool is_linked() const { return pNext != this; }
+};
+
+// Doubly linked list over objects the caller owns: T embeds the links by
+// deriving from intrusive_list_hook<Tag>, so no operation allocates. The list
+// never copies or destroys its elements; an element must be erased (or the
+// list cleared) before the element is destroyed.
+template <class T, class Tag = void>
+class intrusive_list {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = Iterator<intrusive_list>;
+  using const_iterator = const Iterator<intrusive_list>;
+  using size_type = size_t;
+  using hook_type = intrusive_list_hook<Tag>;
+
+  intrusive_list() : size_(0U) {}
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list(intrusive_list &&other) noexcept : size_(0U) {
+    takeNodes(other);
+  }
+  ~intrusive_list() { clear(); }
+
+  intrusive_list &operator=(const intrusive_list &) = delete;
+  intrusive_list &operator=(intrusive_list &&other) noexcept {
+    if (this != &other) {
+      clear();
+      takeNodes(other);
+    }
+    return *this;
+  }
+
+  reference front() const {
+    if (size_ == 0) throw std::out_of_range("list is empty.");
+    return valueOf(fake_.pNext);
+  }
+
+  reference back() const {
+    if (size_ == 0) throw std::out_of_range("list is empty.");
+    return valueOf(fake_.pPrev);
+  }
+
+  iterator begin() { return iterator(fake_.pNext); }
+  const_iterator begin() const { return iterator(fake_.pNext); }
+  const_iterator cbegin() const { return begin(); }
+
+  iterator end() { return iterator(&fake_); }
+  const_iterator end() const { return iterator(sentinel()); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  // Iterator to an element that is in this list.
+  static iterator iterator_to(reference value) {
+    return iterator(static_cast<hook_type *>(&value));
+  }
+
+  void clear() {
+    NodeBase *current = fake_.pNext;
+    while (current != &fake_) {
+      NodeBase *next = current->pNext;
+      current->pNext = current->pPrev = current;
+      current = next;
+    }
+    fake_.pNext = fake_.pPrev = &fake_;
+    size_ = 0;
+  }
+
+  // value must not be linked into another list through the same hook.
+  iterator insert(iterator pos, reference value) {
+    NodeBase *node = static_cast<hook_type *>(&value);
+    NodeBase *at = pos.get_node();
+    node->pNext = at;
+    node->pPrev = at->pPrev;
+    at->pPrev->pNext = node;
+    at->pPrev = node;
+    ++size_;
+    return iterator(node);
+  }
+
+  iterator erase(iterator pos) {
+    if (size_ == 0 || pos.get_node() == &fake_) return end();
+    NodeBase *next = pos.get_node()->pNext;
+    unlink(pos.get_node());
+    return iterator(next);
+  }
+
+  // Unlinks value, which must be in this list, in O(1).
+  void erase(reference value) { unlink(static_cast<hook_type *>(&value)); }
+
+  void push_back(reference value) { insert(end(), value); }
+  void push_front(reference value) { insert(begin(), value); }
+
+  void pop_back() {
+    if (size_ > 0) unlink(fake_.pPrev);
+  }
+
+  void pop_front() {
+    if (size_ > 0) unlink(fake_.pNext);
+  }
+
+  void swap(intrusive_list &other) {
+    if (this != &other) {
+      intrusive_list tmp;
+      tmp.takeNodes(*this);
+      takeNodes(other);
+      other.takeNodes(tmp);
+    }
+  }
+
+  void splice(const_iterator pos, intrusive_list &other) {
+    if (this == &other || other.size_ == 0) return;
+    NodeBase *at = pos.get_node();
+    NodeBase *first = other.fake_.pNext;
+    NodeBase *last = other.fake_.pPrev;
+    first->pPrev = at->pPrev;
+    at->pPrev->pNext = first;
+    last->pNext = at;
+    at->pPrev = last;
+    size_ += other.size_;
+    other.fake_.pNext = other.fake_.pPrev = &other.fake_;
+    other.size_ = 0;
+  }
+
+ private:
+  friend class Iterator<intrusive_list>;
+  friend class ConstIterator<intrusive_list>;
+
+  static reference valueOf(NodeBase *base) {
+    return static_cast<reference>(*static_cast<hook_type *>(base));
+  }
+
+  NodeBase *sentinel() const { return const_cast<NodeBase *>(&fake_); }
+
+  void unlink(NodeBase *node) {
+    node->pPrev->pNext = node->pNext;
+    node->pNext->pPrev = node->pPrev;
+    node->pNext = node->pPrev = node;
+    --size_;
+  }
+
+  // Moves every element of other into this list, which must be empty.
+  void takeNodes(intrusive_list &other) {
+    if (other.size_ == 0) return;
+    fake_.pNext = other.fake_.pNext;
+    fake_.pPrev = other.fake_.pPrev;
+    fake_.pNext->pPrev = fake_.pPrev->pNext = &fake_;
+    size_ = other.size_;
+    other.fake_.pNext = other.fake_.pPrev = &other.fake_;
+    other.size_ = 0;
+  }
+
+  size_type size_;
+  NodeBase fake_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_INTRUSIVE_LIST_S21_INTRUSIVE_LIST_H
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "s21_intrusive_list.h"
+
+namespace {
+
+struct RunQueueTag;
+struct LruTag;
+
+struct Job : s21::intrusive_list_hook<>,
+             s21::intrusive_list_hook<RunQueueTag>,
+             s21::intrusive_list_hook<LruTag> {
+  explicit Job(int id) : id(id) {}
+
+  int id;
+};
+
+using job_list = s21::intrusive_list<Job>;
+using run_queue = s21::intrusive_list<Job, RunQueueTag>;
+using lru_list = s21::intrusive_list<Job, LruTag>;
+
+template <typename List>
+std::vector<int> ids(const List &list) {
+  std::vector<int> result;
+  for (const Job &job : list) result.push_back(job.id);
+  return result;
+}
+
+}  // namespace
+
+TEST(intrusive_list, StartsEmpty) {
+  job_list list;
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.size(), 0U);
+  EXPECT_TRUE(list.begin() == list.end());
+  EXPECT_THROW(list.front(), std::out_of_range);
+  EXPECT_THROW(list.back(), std::out_of_range);
+}
+
+TEST(intrusive_list, LinksCallerOwnedObjects) {
+  std::vector<Job> jobs{Job(1), Job(2), Job(3)};
+  job_list list;
+  list.push_back(jobs[1]);
+  list.push_back(jobs[2]);
+  list.push_front(jobs[0]);
+  EXPECT_EQ(ids(list), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(&list.front(), &jobs[0]);
+  EXPECT_EQ(&list.back(), &jobs[2]);
+  list.front().id = 10;
+  EXPECT_EQ(jobs[0].id, 10);
+  list.clear();
+}
+
+TEST(intrusive_list, EraseByReference) {
+  Job a(1), b(2), c(3);
+  job_list list;
+  list.push_back(a);
+  list.push_back(b);
+  list.push_back(c);
+  EXPECT_TRUE(b.s21::intrusive_list_hook<>::is_linked());
+  list.erase(b);
+  EXPECT_FALSE(b.s21::intrusive_list_hook<>::is_linked());
+  EXPECT_EQ(ids(list), (std::vector<int>{1, 3}));
+  EXPECT_EQ(list.size(), 2U);
+  list.push_front(b);
+  EXPECT_EQ(ids(list), (std::vector<int>{2, 1, 3}));
+  list.clear();
+  EXPECT_FALSE(a.s21::intrusive_list_hook<>::is_linked());
+  EXPECT_FALSE(c.s21::intrusive_list_hook<>::is_linked());
+}
+
+TEST(intrusive_list, IteratorsInsertAndErase) {
+  Job a(1), b(2), c(3), d(4);
+  job_list list;
+  list.push_back(a);
+  list.push_back(c);
+  auto it = list.insert(job_list::iterator_to(c), b);
+  EXPECT_EQ((*it).id, 2);
+  list.insert(list.end(), d);
+  EXPECT_EQ(ids(list), (std::vector<int>{1, 2, 3, 4}));
+  it = list.erase(job_list::iterator_to(c));
+  EXPECT_EQ((*it).id, 4);
+  it = list.erase(it);
+  EXPECT_TRUE(it == list.end());
+  EXPECT_TRUE(list.erase(list.end()) == list.end());
+  auto last = --list.end();
+  EXPECT_EQ((*last).id, 2);
+  list.pop_back();
+  list.pop_front();
+  EXPECT_TRUE(list.empty());
+  list.pop_front();
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(intrusive_list, OneObjectInSeveralLists) {
+  Job a(1), b(2), c(3);
+  run_queue runnable;
+  lru_list recent;
+  runnable.push_back(a);
+  runnable.push_back(b);
+  runnable.push_back(c);
+  recent.push_front(a);
+  recent.push_front(b);
+  recent.push_front(c);
+  EXPECT_EQ(ids(runnable), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(ids(recent), (std::vector<int>{3, 2, 1}));
+  runnable.erase(b);
+  recent.erase(a);
+  recent.push_front(a);
+  EXPECT_EQ(ids(runnable), (std::vector<int>{1, 3}));
+  EXPECT_EQ(ids(recent), (std::vector<int>{1, 3, 2}));
+  runnable.clear();
+  recent.clear();
+}
+
+TEST(intrusive_list, SpliceSwapAndMove) {
+  Job a(1), b(2), c(3), d(4);
+  job_list first;
+  job_list second;
+  first.push_back(a);
+  first.push_back(d);
+  second.push_back(b);
+  second.push_back(c);
+  first.splice(job_list::iterator_to(d), second);
+  EXPECT_EQ(ids(first), (std::vector<int>{1, 2, 3, 4}));
+  EXPECT_TRUE(second.empty());
+  first.swap(second);
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(second.size(), 4U);
+  job_list moved(std::move(second));
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(ids(moved), (std::vector<int>{1, 2, 3, 4}));
+  first = std::move(moved);
+  EXPECT_EQ(ids(first), (std::vector<int>{1, 2, 3, 4}));
+  first.erase(c);
+  EXPECT_EQ(ids(first), (std::vector<int>{1, 2, 4}));
+}
+
+TEST(intrusive_list, CopiesStartUnlinked) {
+  Job a(1);
+  job_list list;
+  list.push_back(a);
+  Job copy(a);
+  EXPECT_FALSE(copy.s21::intrusive_list_hook<>::is_linked());
+  copy = a;
+  EXPECT_FALSE(copy.s21::intrusive_list_hook<>::is_linked());
+  EXPECT_EQ(list.size(), 1U);
+  EXPECT_EQ(&list.front(), &a);
+}
@@ -1,35 +1,41 @@
 #ifndef CPP_2_S21_CONTAINERS_2_SRC_LIST_S21_ITERATOR_H
 #define CPP_2_S21_CONTAINERS_2_SRC_LIST_S21_ITERATOR_H
 
+#include <utility>
+
 #include "s21_list.h"
 
 namespace s21 {
 
+// Links of a list node. The list's sentinel is a bare NodeBase embedded in
+// the list object, so it never needs a T. Iterators only walk these links
+// and ask the container for the element behind a node (Container::valueOf).
+struct NodeBase {
+  NodeBase() : pNext(this), pPrev(this) {}
+
+  NodeBase *pNext;
+  NodeBase *pPrev;
+};
+
 template <typename T>
-struct Node {
+struct Node : NodeBase {
   using value_type = T;
   using const_reference = const T &;
 
-  Node() : data(), pNext(nullptr), pPrev(nullptr) {}
-
-  explicit Node(const_reference value) {
-    data = value;
-    pNext = nullptr;
-    pPrev = nullptr;
-  }
+  template <class... Args>
+  explicit Node(std::in_place_t, Args &&...args)
+      : data(std::forward<Args>(args)...) {}
 
   ~Node() = default;
 
   value_type data;
-  Node<value_type> *pNext;
-  Node<value_type> *pPrev;
 };
 
 template <typename Container>
 class Iterator {
  public:
   using value_type = typename Container::value_type;
-  using pointer_type = Node<value_type> *;
+  using pointer_type = NodeBase *;
   using reference_type = value_type &;
 
   Iterator() noexcept : current_node_(nullptr), iterator_pos_(0) {}
@@ -41,7 +47,7 @@ class Iterator {
 
   Iterator &operator=(const Iterator &other) = default;
 
-  reference_type operator*() const { return current_node_->data; }
+  reference_type operator*() const { return Container::valueOf(current_node_); }
 
   Iterator &operator++() {
     current_node_ = current_node_->pNext;
@@ -90,7 +96,7 @@ template <typename Container>
 class ConstIterator {
  public:
   using value_type = const typename Container::value_type;
-  using pointer_type = Node<value_type> *;
+  using pointer_type = NodeBase *;
   using reference_type = value_type &;
 
   ConstIterator() noexcept : current_node_(nullptr), iterator_pos_(0) {}
@@ -102,7 +108,7 @@ class ConstIterator {
 
   ConstIterator &operator=(const ConstIterator &other) = default;
 
-  reference_type operator*() const { return current_node_->data; }
+  reference_type operator*() const { return Container::valueOf(current_node_); }
 
   ConstIterator &operator++() {
     current_node_ = current_node_->pNext;
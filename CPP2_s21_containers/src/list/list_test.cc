@@ -1,9 +1,50 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <memory>
+#include <string>
+#include <type_traits>
 
 #include "s21_list.h"
 
+namespace {
+
+// Counts the nodes a list holds through its allocator.
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+
+  T *allocate(std::size_t n) {
+    live += static_cast<long>(n);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *ptr, std::size_t n) {
+    live -= static_cast<long>(n);
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  static long live;
+};
+
+template <typename T>
+long CountingAllocator<T>::live = 0;
+
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T> &, const CountingAllocator<U> &) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T> &, const CountingAllocator<U> &) {
+  return false;
+}
+
+}  // namespace
+
 TEST(ListConstructors, Default1) {
   s21::list<int> own_list;
   std::list<int> orig_list;
@@ -849,6 +890,67 @@ TEST(ListMergeTest, MergeListsWithDifferentTypes) {
   EXPECT_EQ(list1, expected);
 }
 
+TEST(ListMergeTest, MergeIsStable) {
+  // Elements compare by their tens digit only; the ones digit tells apart
+  // equal elements.
+  s21::list<int> list1 = {10, 20, 21, 40};
+  s21::list<int> list2 = {2, 22, 42, 52};
+  s21::list<int> expected = {2, 10, 20, 21, 22, 40, 42, 52};
+
+  list1.merge(list2, [](int a, int b) { return a / 10 < b / 10; });
+
+  EXPECT_EQ(list1, expected);
+  EXPECT_TRUE(list2.empty());
+}
+
+TEST(ListMergeTest, MergeWithComparator) {
+  s21::list<int> list1 = {9, 5, 1};
+  s21::list<int> list2 = {10, 8, 2, 0};
+  s21::list<int> expected = {10, 9, 8, 5, 2, 1, 0};
+
+  list1.merge(list2, std::greater<int>());
+
+  EXPECT_EQ(list1, expected);
+  EXPECT_EQ(list1.front(), 10);
+  EXPECT_EQ(list1.back(), 0);
+}
+
+TEST(ListMergeTest, MergeRelinksNodes) {
+  s21::list<int> list1 = {1, 4};
+  s21::list<int> list2 = {2, 3, 5};
+  int *moved = &*list2.begin();
+
+  list1.merge(list2);
+
+  auto it = list1.begin();
+  ++it;
+  EXPECT_EQ(&*it, moved);
+  EXPECT_EQ(list1, s21::list<int>({1, 2, 3, 4, 5}));
+
+  list2.push_back(7);
+  EXPECT_EQ(list2.size(), 1U);
+  EXPECT_EQ(list2.front(), 7);
+}
+
+TEST(ListMergeTest, MergeLargeListsInLinearTime) {
+  s21::list<int> list1;
+  s21::list<int> list2;
+  for (int i = 0; i < 200000; ++i) {
+    list1.push_back(2 * i);
+    list2.push_back(2 * i + 1);
+  }
+
+  list1.merge(list2);
+
+  EXPECT_EQ(list1.size(), 400000U);
+  int expected = 0;
+  for (int value : list1) EXPECT_EQ(value, expected++);
+  for (auto it = list1.end(); it != list1.begin();) {
+    --it;
+    EXPECT_EQ(*it, --expected);
+  }
+}
+
 TEST(ListSpliceTest, SpliceEmptyLists) {
   s21::list<int> list1;
   s21::list<int> list2;
@@ -920,6 +1022,92 @@ TEST(ListSpliceTest, SpliceInMiddle) {
   EXPECT_TRUE(list1 == expected);
 }
 
+TEST(ListSpliceTest, SpliceOneElementFromOtherList) {
+  s21::list<int> list1 = {1, 2, 3};
+  s21::list<int> list2 = {4, 5, 6};
+  s21::list<int> expected1 = {1, 5, 2, 3};
+  s21::list<int> expected2 = {4, 6};
+
+  auto moved = ++list2.begin();
+  list1.splice(++list1.begin(), list2, moved);
+
+  EXPECT_EQ(list1.size(), 4);
+  EXPECT_EQ(list2.size(), 2);
+  EXPECT_TRUE(list1 == expected1);
+  EXPECT_TRUE(list2 == expected2);
+  EXPECT_EQ(*moved, 5);
+  EXPECT_EQ(*--moved, 1);
+}
+
+TEST(ListSpliceTest, SpliceOneElementWithinList) {
+  s21::list<int> list = {1, 2, 3, 4};
+  s21::list<int> expected = {4, 1, 2, 3};
+
+  list.splice(list.begin(), list, --list.end());
+  EXPECT_TRUE(list == expected);
+  list.splice(list.end(), list, list.begin());
+  list.splice(list.begin(), list, list.begin());
+  list.splice(++++list.begin(), list, list.begin());
+
+  s21::list<int> rotated = {2, 1, 3, 4};
+  EXPECT_EQ(list.size(), 4);
+  EXPECT_TRUE(list == rotated);
+  EXPECT_EQ(list.back(), 4);
+}
+
+TEST(ListSpliceTest, SpliceRangeFromOtherList) {
+  s21::list<int> list1 = {1, 2};
+  s21::list<int> list2 = {3, 4, 5, 6, 7};
+  s21::list<int> expected1 = {1, 4, 5, 6, 2};
+  s21::list<int> expected2 = {3, 7};
+
+  auto first = ++list2.begin();
+  auto last = --list2.end();
+  list1.splice(--list1.end(), list2, first, last);
+
+  EXPECT_EQ(list1.size(), 5);
+  EXPECT_EQ(list2.size(), 2);
+  EXPECT_TRUE(list1 == expected1);
+  EXPECT_TRUE(list2 == expected2);
+
+  list1.splice(list1.end(), list2, list2.begin(), list2.begin());
+  EXPECT_EQ(list2.size(), 2);
+  list1.splice(list1.end(), list2, list2.begin(), list2.end(), 2);
+  EXPECT_EQ(list1.size(), 7);
+  EXPECT_TRUE(list2.empty());
+  EXPECT_EQ(list1.back(), 7);
+  list2.push_back(8);
+  EXPECT_EQ(list2.front(), 8);
+}
+
+TEST(ListSpliceTest, SpliceRangeWithinList) {
+  s21::list<int> list = {1, 2, 3, 4, 5, 6};
+  s21::list<int> expected = {4, 5, 1, 2, 3, 6};
+
+  auto first = list.begin();
+  for (int i = 0; i < 3; ++i) ++first;
+  auto last = first;
+  ++last;
+  ++last;
+  list.splice(list.begin(), list, first, last);
+
+  EXPECT_EQ(list.size(), 6);
+  EXPECT_TRUE(list == expected);
+  EXPECT_EQ(*--list.end(), 6);
+  EXPECT_EQ(*----list.end(), 3);
+}
+
+TEST(ListSpliceTest, MoveToFrontKeepsNodes) {
+  s21::list<int> lru = {1, 2, 3, 4, 5};
+  auto hot = lru.begin();
+  for (int i = 0; i < 3; ++i) ++hot;
+  int *address = &*hot;
+  lru.splice(lru.begin(), lru, hot);
+  EXPECT_EQ(&lru.front(), address);
+  s21::list<int> expected = {4, 1, 2, 3, 5};
+  EXPECT_TRUE(lru == expected);
+}
+
 TEST(ListOperations, UniqueEmptyList) {
   s21::list<int> list;
   list.unique();
@@ -975,6 +1163,63 @@ TEST(ListOperations, UniqueCustomTypeDuplicatesAtStart) {
   EXPECT_EQ(list, expected);
 }
 
+TEST(ListOperations, UniqueKeepsNonAdjacentRepeats) {
+  s21::list<int> list = {1, 1, 2, 1, 1, 3, 2, 2};
+  s21::list<int> expected = {1, 2, 1, 3, 2};
+  list.unique();
+  EXPECT_EQ(list, expected);
+}
+
+TEST(ListOperations, UniqueWithPredicate) {
+  s21::list<int> list = {10, 12, 19, 21, 5, 30, 31, 39, 40};
+  s21::list<int> expected = {10, 21, 5, 30, 40};
+  list.unique([](int kept, int element) { return kept / 10 == element / 10; });
+  EXPECT_EQ(list, expected);
+  EXPECT_EQ(list.size(), 5);
+}
+
+TEST(ListOperations, DedupKeepsFirstOccurrence) {
+  s21::list<std::string> list = {"b", "a", "b", "c", "a", "a", "d", "c"};
+  s21::list<std::string> expected = {"b", "a", "c", "d"};
+  list.dedup();
+  EXPECT_EQ(list, expected);
+  EXPECT_EQ(list.back(), "d");
+
+  s21::list<int> empty;
+  empty.dedup();
+  EXPECT_TRUE(empty.empty());
+}
+
+TEST(ListOperations, DedupWithCustomHashAndEquality) {
+  s21::list<int> list = {3, 13, 4, 23, 14, 5};
+  s21::list<int> expected = {3, 4, 5};
+  list.dedup([](int value) { return std::hash<int>()(value % 10); },
+             [](int a, int b) { return a % 10 == b % 10; });
+  EXPECT_EQ(list, expected);
+}
+
+TEST(ListOperations, SortUnique) {
+  s21::list<int> list = {5, 3, 5, 1, 3, 3, 9, 1};
+  s21::list<int> expected = {1, 3, 5, 9};
+  list.sort_unique();
+  EXPECT_EQ(list, expected);
+
+  s21::list<int> descending = {5, 3, 5, 1};
+  s21::list<int> expected_descending = {5, 3, 1};
+  descending.sort_unique(std::greater<int>());
+  EXPECT_EQ(descending, expected_descending);
+}
+
+TEST(ListOperations, UniqueLargeListIsLinear) {
+  s21::list<int> list;
+  for (int i = 0; i < 2000000; ++i) list.push_back(i / 4);
+  list.unique();
+  EXPECT_EQ(list.size(), 500000);
+  list.dedup();
+  EXPECT_EQ(list.size(), 500000);
+  EXPECT_EQ(list.back(), 499999);
+}
+
 TEST(ListSort, EmptyList) {
   s21::list<int> list;
   s21::list<int> expected;
@@ -1038,6 +1283,46 @@ TEST(ListSort, SortEmptyList) {
   EXPECT_EQ(list, expected);
 }
 
+TEST(ListSort, WithComparator) {
+  s21::list<int> list = {3, 5, 2, 4, 1};
+  s21::list<int> expected = {5, 4, 3, 2, 1};
+  list.sort(std::greater<int>());
+  EXPECT_EQ(list, expected);
+}
+
+TEST(ListSort, IsStable) {
+  // Elements compare by their tens digit only.
+  s21::list<int> list = {31, 12, 30, 11, 32, 10, 2};
+  s21::list<int> expected = {2, 12, 11, 10, 31, 30, 32};
+  list.sort([](int a, int b) { return a / 10 < b / 10; });
+  EXPECT_EQ(list, expected);
+}
+
+TEST(ListSort, MatchesStdListOnLargeInput) {
+  s21::list<int> list;
+  std::list<int> std_list;
+  unsigned state = 7;
+  for (int i = 0; i < 100000; ++i) {
+    state = state * 1103515245U + 12345U;
+    int value = static_cast<int>((state >> 8) % 5000);
+    list.push_back(value);
+    std_list.push_back(value);
+  }
+  list.sort();
+  std_list.sort();
+  EXPECT_EQ(list.size(), std_list.size());
+  auto std_it = std_list.begin();
+  for (int value : list) EXPECT_EQ(value, *std_it++);
+  EXPECT_EQ(list.back(), std_list.back());
+  auto it = list.end();
+  --it;
+  EXPECT_EQ(*it, std_list.back());
+  list.push_back(-1);
+  list.push_front(-2);
+  EXPECT_EQ(list.front(), -2);
+  EXPECT_EQ(list.back(), -1);
+}
+
 TEST(ListModifiers, InsertManyInEmptyList) {
   s21::list<int> list;
   s21::list<int> expected = {42, 1, 2, 3};
@@ -1089,4 +1374,204 @@ TEST(ListModifiers, InsertManyBackAtEnd) {
   EXPECT_EQ(list.size(), 5);
   EXPECT_EQ(list.back(), 5);
   EXPECT_TRUE(list == expected);
-}
\ No newline at end of file
+}
+
+TEST(ListAllocator, NodesGoThroughTheAllocator) {
+  using alloc_list = s21::list<int, CountingAllocator<int>>;
+  long &live = CountingAllocator<s21::Node<int>>::live;
+  {
+    alloc_list list{1, 2, 3};
+    EXPECT_EQ(live, 3);
+    list.insert(++list.begin(), 7);
+    list.push_front(0);
+    EXPECT_EQ(live, 5);
+    list.erase(list.begin());
+    list.pop_back();
+    EXPECT_EQ(live, 3);
+    alloc_list other{9};
+    list.splice(list.begin(), other);
+    list.sort();
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 9);
+    EXPECT_EQ(live, 4);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST(ListAllocator, EmptyListsAllocateNothing) {
+  using alloc_list = s21::list<int, CountingAllocator<int>>;
+  long &live = CountingAllocator<s21::Node<int>>::live;
+  alloc_list list;
+  alloc_list moved(std::move(list));
+  EXPECT_EQ(live, 0);
+  for (int i = 0; i < 100; ++i) {
+    moved.push_back(i);
+    EXPECT_EQ(live, 1);
+    moved.pop_front();
+    EXPECT_EQ(live, 0);
+  }
+  moved.push_front(1);
+  list = std::move(moved);
+  EXPECT_EQ(live, 1);
+  EXPECT_EQ(list.front(), 1);
+  EXPECT_TRUE(moved.empty());
+  EXPECT_TRUE(moved.begin() == moved.end());
+}
+
+namespace {
+
+struct NoDefault {
+  explicit NoDefault(int value) : value(value) {}
+  bool operator<(const NoDefault &other) const { return value < other.value; }
+  bool operator==(const NoDefault &other) const {
+    return value == other.value;
+  }
+
+  int value;
+};
+
+}  // namespace
+
+TEST(ListSentinel, ElementsNeedNoDefaultConstructor) {
+  s21::list<NoDefault> list{NoDefault(3), NoDefault(1)};
+  list.push_front(NoDefault(2));
+  list.sort();
+  EXPECT_EQ(list.front().value, 1);
+  EXPECT_EQ(list.back().value, 3);
+  list.reverse();
+  EXPECT_EQ(list.front().value, 3);
+  EXPECT_EQ((*--list.end()).value, 1);
+}
+
+TEST(ListSentinel, MovedListsKeepTheirSentinel) {
+  s21::list<int> first{1, 2, 3};
+  s21::list<int> second(std::move(first));
+  s21::list<int> third{7};
+  third.swap(second);
+  EXPECT_TRUE(second == s21::list<int>{7});
+  EXPECT_TRUE(first.empty());
+  int expected = 3;
+  for (auto it = --third.end(); it != third.end(); --it) {
+    EXPECT_EQ(*it, expected--);
+  }
+  EXPECT_EQ(expected, 0);
+  first.push_back(5);
+  EXPECT_EQ(first.front(), 5);
+}
+
+TEST(ListAllocator, StdAllocatorWorks) {
+  static_assert(std::is_same_v<s21::list<int>::allocator_type,
+                               std::allocator<int>>);
+  s21::list<std::string> list{"b", "a"};
+  list.sort();
+  EXPECT_EQ(list.front(), "a");
+  EXPECT_EQ(list.back(), "b");
+}
+
+TEST(ListAllocator, PooledNodesSurviveChurn) {
+  s21::pooled_list<int> list;
+  std::list<int> expected;
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 1000; ++i) {
+      list.push_back(round * 1000 + i);
+      expected.push_back(round * 1000 + i);
+    }
+    for (int i = 0; i < 900; ++i) {
+      list.pop_front();
+      expected.pop_front();
+    }
+  }
+  ASSERT_EQ(list.size(), expected.size());
+  auto it = list.begin();
+  for (int value : expected) EXPECT_EQ(*it++, value);
+}
+
+namespace {
+
+// Counts how each element came to be.
+struct Tracked {
+  Tracked(int a, int b) : value(a * 10 + b) { ++made; }
+  explicit Tracked(int value) : value(value) { ++made; }
+  Tracked(const Tracked &other) : value(other.value) { ++copies; }
+  Tracked(Tracked &&other) noexcept : value(other.value) { ++moves; }
+  Tracked &operator=(const Tracked &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  Tracked &operator=(Tracked &&other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+
+  static void reset() { made = copies = moves = 0; }
+
+  int value;
+  static int made;
+  static int copies;
+  static int moves;
+};
+
+int Tracked::made = 0;
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+}  // namespace
+
+TEST(ListEmplace, ConstructsInPlace) {
+  s21::list<Tracked> list;
+  Tracked::reset();
+  Tracked &back = list.emplace_back(1, 2);
+  Tracked &front = list.emplace_front(3);
+  auto it = list.emplace(++list.begin(), 4, 5);
+  EXPECT_EQ(Tracked::made, 3);
+  EXPECT_EQ(Tracked::copies + Tracked::moves, 0);
+  EXPECT_EQ(back.value, 12);
+  EXPECT_EQ(front.value, 3);
+  EXPECT_EQ((*it).value, 45);
+  EXPECT_EQ(list.front().value, 3);
+  EXPECT_EQ(list.back().value, 12);
+}
+
+TEST(ListEmplace, RvaluesAreMovedNotCopied) {
+  s21::list<Tracked> list;
+  Tracked a(1), b(2), c(3);
+  Tracked::reset();
+  list.push_back(std::move(a));
+  list.push_front(std::move(b));
+  list.insert(list.end(), std::move(c));
+  EXPECT_EQ(Tracked::moves, 3);
+  EXPECT_EQ(Tracked::copies, 0);
+  list.push_back(a);
+  EXPECT_EQ(Tracked::copies, 1);
+}
+
+TEST(ListEmplace, InsertManyForwardsArguments) {
+  s21::list<Tracked> list;
+  list.emplace_back(9);
+  Tracked::reset();
+  list.insert_many_back(Tracked(1), Tracked(2));
+  list.insert_many_front(Tracked(3));
+  list.insert_many(++list.begin(), Tracked(4), Tracked(5));
+  EXPECT_EQ(Tracked::made, 5);
+  EXPECT_EQ(Tracked::moves, 5);
+  EXPECT_EQ(Tracked::copies, 0);
+  int expected[] = {3, 4, 5, 9, 1, 2};
+  int i = 0;
+  for (const auto &item : list) EXPECT_EQ(item.value, expected[i++]);
+}
+
+TEST(ListEmplace, MoveOnlyElements) {
+  s21::list<std::unique_ptr<int>> list;
+  list.push_back(std::make_unique<int>(1));
+  list.emplace_front(new int(0));
+  list.insert_many_back(std::make_unique<int>(2), std::make_unique<int>(3));
+  list.sort([](const std::unique_ptr<int> &a, const std::unique_ptr<int> &b) {
+    return *a > *b;
+  });
+  EXPECT_EQ(*list.front(), 3);
+  EXPECT_EQ(*list.back(), 0);
+  EXPECT_EQ(list.size(), 4U);
+}
+
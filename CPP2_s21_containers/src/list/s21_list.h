@@ -6,71 +6,88 @@
 #include <initializer_list>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <ostream>
+#include <unordered_set>
 #include <utility>
 
+#include "../allocator/s21_allocator_propagation.h"
+#include "../allocator/s21_pool_allocator.h"
 #include "Iterator.h"
 
 namespace s21 {
 
-template <class T>
+template <class T, class Allocator = std::allocator<T>>
 class list {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
-  using iterator = Iterator<list<value_type>>;
-  using const_iterator = const Iterator<list<value_type>>;
+  using iterator = Iterator<list>;
+  using const_iterator = const Iterator<list>;
   using size_type = size_t;
 
-  list();
+  list() : size_(0U) {}
+
+  explicit list(const Allocator &alloc) : alloc_(alloc), size_(0U) {}
 
-  explicit list(size_type n);
+  explicit list(size_type n, const Allocator &alloc = Allocator());
 
-  list(std::initializer_list<value_type> const &items);
+  list(std::initializer_list<value_type> const &items,
+       const Allocator &alloc = Allocator());
 
   list(const list &other)
-      : size_(0u), head_(nullptr), tail_(nullptr), fake_(nullptr) {
+      : alloc_(node_traits::select_on_container_copy_construction(
+            other.alloc_)),
+        size_(0U) {
     for (const auto &i : other) {
       push_back(i);
     }
   };
 
-  list(list &&other) noexcept;
+  list(list &&other) noexcept : alloc_(std::move(other.alloc_)), size_(0U) {
+    takeNodes(other);
+  }
 
   ~list() { clear(); };
 
   bool operator==(const list &other) const;
   bool operator!=(const list &other) const;
 
-  list &operator=(const list &other) noexcept;
+  list &operator=(const list &other);
 
-  list &operator=(list &&other) noexcept;
+  list &operator=(list &&other) noexcept(
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value ||
+      std::allocator_traits<Allocator>::is_always_equal::value);
 
   list &operator=(std::initializer_list<value_type> const &items);
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
   const_reference front() const {
-    if (head_ == nullptr) {
+    if (size_ == 0) {
       throw std::out_of_range("list is empty.");
     }
-    return *iterator(head_);
+    return node(fake_.pNext)->data;
   };
 
   const_reference back() const {
-    if (tail_ == nullptr) {
+    if (size_ == 0) {
       throw std::out_of_range("list is empty.");
     }
-    return *iterator(tail_);
+    return node(fake_.pPrev)->data;
   };
 
-  iterator begin() { return iterator(head_); };
-  const_iterator begin() const { return iterator(head_); };
+  iterator begin() { return iterator(fake_.pNext); };
+  const_iterator begin() const { return iterator(fake_.pNext); };
 
   const_iterator cbegin() const;
 
-  iterator end() { return iterator(fake_); };
+  iterator end() { return iterator(&fake_); };
 
-  const_iterator end() const { return iterator(fake_); };
+  const_iterator end() const { return iterator(sentinel()); };
 
   const_iterator cend() const;
 
@@ -86,102 +103,192 @@ class list {
 
   iterator insert(iterator pos, const_reference value);
 
+  iterator insert(iterator pos, value_type &&value);
+
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+
   iterator erase(iterator pos);
 
   void push_back(const_reference value);
 
+  void push_back(value_type &&value);
+
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+
   void pop_back();
 
   void push_front(const_reference value);
 
+  void push_front(value_type &&value);
+
+  template <class... Args>
+  reference emplace_front(Args &&...args);
+
   void pop_front();
 
   void swap(list &other);
 
   void merge(list &other);
 
+  template <class Compare>
+  void merge(list &other, Compare comp);
+
   void splice(const_iterator pos, list &other);
 
+  void splice(const_iterator pos, list &other, const_iterator it);
+
+  void splice(const_iterator pos, list &other, const_iterator first,
+              const_iterator last);
+
+  void splice(const_iterator pos, list &other, const_iterator first,
+              const_iterator last, size_type count);
+
   void reverse();
 
   void unique();
 
+  template <class BinaryPredicate>
+  void unique(BinaryPredicate pred);
+
+  template <class Hash = std::hash<value_type>,
+            class KeyEqual = std::equal_to<value_type>>
+  void dedup(Hash hash = Hash(), KeyEqual equal = KeyEqual());
+
+  void sort_unique();
+
+  template <class Compare>
+  void sort_unique(Compare comp);
+
   void sort();
 
+  template <class Compare>
+  void sort(Compare comp);
+
   template <class... Args>
   iterator insert_many(const_iterator pos, Args &&...args) {
-    auto pos_current = pos;
-    for (auto &arg : {args...}) {
-      insert(pos_current, arg);
-    }
+    (emplace(pos, std::forward<Args>(args)), ...);
     return pos;
   }
 
   template <class... Args>
   void insert_many_back(Args &&...args) {
-    for (auto &arg : {args...}) {
-      push_back(arg);
-    }
+    (emplace_back(std::forward<Args>(args)), ...);
   }
 
   template <class... Args>
   void insert_many_front(Args &&...args) {
-    for (auto &arg : {args...}) {
-      push_front(arg);
-    }
+    (emplace_front(std::forward<Args>(args)), ...);
   }
 
   T &operator[](const int index);
 
  private:
+  friend class Iterator<list>;
+  friend class ConstIterator<list>;
+
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node<value_type>>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  static Node<value_type> *node(NodeBase *base) {
+    return static_cast<Node<value_type> *>(base);
+  }
+
+  static reference valueOf(NodeBase *base) { return node(base)->data; }
+
+  NodeBase *sentinel() const { return const_cast<NodeBase *>(&fake_); }
+
+  static void linkBefore(NodeBase *pos, NodeBase *node) {
+    node->pNext = pos;
+    node->pPrev = pos->pPrev;
+    pos->pPrev->pNext = node;
+    pos->pPrev = node;
+  }
+
+  static void unlink(NodeBase *node) {
+    node->pPrev->pNext = node->pNext;
+    node->pNext->pPrev = node->pPrev;
+  }
+
+  // Relinks the nodes [first, last) in front of pos, which must lie outside
+  // the range. Sizes are left to the caller.
+  static void transfer(NodeBase *pos, NodeBase *first, NodeBase *last) {
+    if (pos == last) return;
+    NodeBase *tail = last->pPrev;
+    first->pPrev->pNext = last;
+    last->pPrev = first->pPrev;
+    first->pPrev = pos->pPrev;
+    pos->pPrev->pNext = first;
+    tail->pNext = pos;
+    pos->pPrev = tail;
+  }
+
+  // Moves every node of other into this list, which must be empty.
+  void takeNodes(list &other) {
+    if (other.size_ == 0) return;
+    fake_.pNext = other.fake_.pNext;
+    fake_.pPrev = other.fake_.pPrev;
+    fake_.pNext->pPrev = fake_.pPrev->pNext = &fake_;
+    size_ = other.size_;
+    other.fake_.pNext = other.fake_.pPrev = &other.fake_;
+    other.size_ = 0;
+  }
+
+  template <class Compare>
+  static NodeBase *mergeChains(NodeBase *first, NodeBase *second,
+                               Compare &comp);
+
+  template <class... Args>
+  Node<value_type> *createNode(Args &&...args) {
+    Node<value_type> *node = node_traits::allocate(alloc_, 1);
+    try {
+      node_traits::construct(alloc_, node, std::in_place,
+                             std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroyNode(NodeBase *base) {
+    Node<value_type> *node = list::node(base);
+    node_traits::destroy(alloc_, node);
+    node_traits::deallocate(alloc_, node, 1);
+  }
+
+  node_allocator alloc_;
+
   size_type size_;
 
-  Node<value_type> *head_;
-  Node<value_type> *tail_;
-  Node<value_type> *fake_;
+  // Embedded sentinel: begin() is fake_.pNext and end() is &fake_.
+  NodeBase fake_;
 };
 
-template <typename T>
-list<T>::list() : size_(0U), head_(nullptr), tail_(nullptr), fake_(nullptr) {
-  auto *fake_node = new Node<value_type>();
-  fake_ = head_ = tail_ = fake_node;
-  fake_node->pNext = head_;
-  fake_node->pPrev = tail_;
-}
-
-template <typename T>
-list<T>::list(size_type n)
-    : size_(0U), head_(nullptr), tail_(nullptr), fake_(nullptr) {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(size_type n, const Allocator &alloc)
+    : alloc_(alloc), size_(0U) {
   for (size_t i = 0; i < n; i++) {
-    push_back(const_reference{});
+    emplace_back();
   }
 }
 
-template <typename T>
-list<T>::list(std::initializer_list<value_type> const &items)
-    : size_(0U), head_(nullptr), tail_(nullptr), fake_(nullptr) {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(std::initializer_list<value_type> const &items,
+                         const Allocator &alloc)
+    : alloc_(alloc), size_(0U) {
   for (const auto &i : items) {
     push_back(i);
   }
 }
 
-template <typename T>
-list<T>::list(list<T> &&other) noexcept {
-  if (this != &other && !other.empty()) {
-    head_ = other.head_;
-    tail_ = other.tail_;
-    fake_ = other.fake_;
-    size_ = other.size_;
-
-    other.head_ = other.tail_ = other.fake_ = nullptr;
-    other.size_ = 0;
-  }
-}
-
-template <typename T>
-list<T> &list<T>::operator=(const list &other) noexcept {
+template <typename T, typename Allocator>
+list<T, Allocator> &list<T, Allocator>::operator=(const list &other) {
   if (this != &other) {
     clear();
+    propagateOnCopyAssign(alloc_, other.alloc_);
     for (const auto &i : other) {
       push_back(i);
     }
@@ -189,23 +296,27 @@ list<T> &list<T>::operator=(const list &other) noexcept {
   return *this;
 }
 
-template <typename T>
-list<T> &list<T>::operator=(list<T> &&other) noexcept {
+template <typename T, typename Allocator>
+list<T, Allocator> &list<T, Allocator>::operator=(list &&other) noexcept(
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
   if (this != &other) {
     clear();
-    head_ = other.head_;
-    tail_ = other.tail_;
-    fake_ = other.fake_;
-    size_ = other.size_;
-
-    other.head_ = other.tail_ = other.fake_ = nullptr;
-    other.size_ = 0;
+    if (canStealOnMoveAssign(alloc_, other.alloc_)) {
+      propagateOnMoveAssign(alloc_, other.alloc_);
+      takeNodes(other);
+    } else {
+      for (auto &i : other) push_back(std::move(i));
+      other.clear();
+    }
   }
   return *this;
 }
 
-template <typename T>
-list<T> &list<T>::operator=(std::initializer_list<value_type> const &items) {
+template <typename T, typename Allocator>
+list<T, Allocator> &list<T, Allocator>::operator=(
+    std::initializer_list<value_type> const &items) {
   clear();
   for (const auto &i : items) {
     push_back(i);
@@ -213,306 +324,392 @@ list<T> &list<T>::operator=(std::initializer_list<value_type> const &items) {
   return *this;
 }
 
-template <typename T>
-void list<T>::push_back(const_reference value) {
-  auto *new_node = new Node<value_type>;
-  Node<value_type> *fake_node;
-  if (size_ == 0) {
-    fake_node = (fake_ == nullptr ? new Node<value_type>() : fake_);
-    new_node->pNext = new_node->pPrev = fake_node;
-    fake_node->pNext = fake_node->pPrev = new_node;
-    head_ = tail_ = new_node;
-    fake_ = fake_node;
-  } else {
-    new_node->pPrev = tail_;
-    tail_->pNext = new_node;
-    new_node->pNext = fake_;
-    fake_->pPrev = new_node;
-    tail_ = new_node;
-  }
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+typename list<T, Allocator>::reference list<T, Allocator>::emplace_back(
+    Args &&...args) {
+  Node<value_type> *node = createNode(std::forward<Args>(args)...);
+  linkBefore(&fake_, node);
   size_++;
-  new_node->data = value;
-  fake_->data = size_;
+  return node->data;
 }
 
-template <typename T>
-void list<T>::push_front(const_reference value) {
-  auto *new_node = new Node<value_type>;
-  Node<value_type> *fake_node;
-  if (size_ == 0) {
-    fake_node = (fake_ == nullptr ? new Node<value_type>() : fake_);
-    new_node->pNext = new_node->pPrev = fake_node;
-    fake_node->pNext = fake_node->pPrev = new_node;
-    head_ = tail_ = new_node;
-    fake_ = fake_node;
-  } else {
-    new_node->pNext = head_;
-    head_->pPrev = new_node;
-    new_node->pPrev = fake_;
-    fake_->pNext = new_node;
-    head_ = new_node;
-  }
-  new_node->data = value;
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+typename list<T, Allocator>::reference list<T, Allocator>::emplace_front(
+    Args &&...args) {
+  Node<value_type> *node = createNode(std::forward<Args>(args)...);
+  linkBefore(fake_.pNext, node);
   ++size_;
-  fake_->data = size_;
+  return node->data;
 }
 
-template <typename T>
-T &list<T>::operator[](const int index) {
+template <typename T, typename Allocator>
+T &list<T, Allocator>::operator[](const int index) {
   int counter = 0;
-  Node<value_type> *current = this->head_;
-  while (current->pNext != fake_) {
+  NodeBase *current = fake_.pNext;
+  while (current->pNext != &fake_) {
     if (counter == index) {
-      return current->data;
+      return node(current)->data;
     }
     current = current->pNext;
     counter++;
   }
-  return current->data;
+  return node(current)->data;
 }
 
-template <typename T>
-void list<T>::pop_back() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_back() {
   if (size_ > 0) {
-    Node<value_type> *tmp = tail_;
-    tail_ = fake_->pPrev = tail_->pPrev;
-    delete tmp;
+    NodeBase *tmp = fake_.pPrev;
+    unlink(tmp);
+    destroyNode(tmp);
     size_--;
-    if (!size_ && fake_ != nullptr) {
-      delete fake_;
-      fake_ = head_ = tail_ = nullptr;
-    } else {
-      tail_->pNext = fake_;
-    }
   }
 }
 
-template <typename T>
-void list<T>::pop_front() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_front() {
   if (size_ > 0) {
-    Node<value_type> *tmp = head_;
-    head_ = fake_->pNext = head_->pNext;
-    delete tmp;
+    NodeBase *tmp = fake_.pNext;
+    unlink(tmp);
+    destroyNode(tmp);
     size_--;
-    if (!size_) {
-      delete fake_;
-      fake_ = head_ = tail_ = nullptr;
-    } else {
-      head_->pPrev = fake_;
-    }
   }
 }
 
-template <typename T>
-void list<T>::clear() {
-  while (size_ != 0 && fake_ != nullptr && head_ != nullptr) {
-    pop_back();
-  }
-  if (fake_ != nullptr) {
-    delete fake_;
-    fake_ = head_ = tail_ = nullptr;
+template <typename T, typename Allocator>
+void list<T, Allocator>::clear() {
+  NodeBase *current = fake_.pNext;
+  while (current != &fake_) {
+    NodeBase *next = current->pNext;
+    destroyNode(current);
+    current = next;
   }
+  fake_.pNext = fake_.pPrev = &fake_;
+  size_ = 0;
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::insert(iterator pos,
-                                           const_reference value) {
-  Node<value_type> *insert_node;
-  if (pos == begin()) {
-    push_front(value);
-    insert_node = head_;
-  } else if (pos == end()) {
-    push_back(value);
-    insert_node = tail_;
-  } else {
-    insert_node = new Node<value_type>(value);
-    Node<value_type> *current_pos = pos.get_node();
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(
+    iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
 
-    insert_node->pNext = current_pos;
-    insert_node->pPrev = current_pos->pPrev;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(
+    iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
 
-    current_pos->pPrev->pNext = insert_node;
-    current_pos->pPrev = insert_node;
-    size_++;
-  }
+template <typename T, typename Allocator>
+template <class... Args>
+typename list<T, Allocator>::iterator list<T, Allocator>::emplace(
+    const_iterator pos, Args &&...args) {
+  NodeBase *insert_node = createNode(std::forward<Args>(args)...);
+  linkBefore(pos.get_node(), insert_node);
+  size_++;
   return iterator(insert_node);
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::erase(iterator pos) {
-  if (size_) {
-    Node<value_type> *last_pos = fake_;
-    if (pos == begin()) {
-      pop_front();
-      last_pos = head_;
-    } else if (pos == --end()) {
-      pop_back();
-      last_pos = fake_;
-    } else if (pos != end()) {
-      Node<value_type> *current_pos = pos.get_node();
-      current_pos->pPrev->pNext = current_pos->pNext;
-      current_pos->pNext->pPrev = current_pos->pPrev;
-      last_pos = current_pos->pNext;
-      delete current_pos;
-      size_--;
-    }
-    fake_->data = size_;
-    return iterator(last_pos);
-  }
-  return end();
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::erase(iterator pos) {
+  NodeBase *current_pos = pos.get_node();
+  if (size_ == 0 || current_pos == &fake_) return end();
+  NodeBase *last_pos = current_pos->pNext;
+  unlink(current_pos);
+  destroyNode(current_pos);
+  size_--;
+  return iterator(last_pos);
 }
 
-template <typename T>
-void list<T>::swap(list<T> &other) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::swap(list<T, Allocator> &other) {
   if (this != &other) {
-    Node<value_type> *tmp_head_ = head_;
-    Node<value_type> *tmp_tail_ = tail_;
-    Node<value_type> *tmp_fake_ = fake_;
-    size_type tmp_size_ = size_;
-
-    head_ = other.head_;
-    tail_ = other.tail_;
-    fake_ = other.fake_;
-    size_ = other.size_;
-
-    other.head_ = tmp_head_;
-    other.tail_ = tmp_tail_;
-    other.fake_ = tmp_fake_;
-    other.size_ = tmp_size_;
+    propagateOnSwap(alloc_, other.alloc_);
+    list tmp(get_allocator());
+    tmp.takeNodes(*this);
+    takeNodes(other);
+    other.takeNodes(tmp);
   }
 }
 
-template <typename T>
-void list<T>::merge(list<T> &other) {
-  if (this == &other) return;
+template <typename T, typename Allocator>
+void list<T, Allocator>::merge(list<T, Allocator> &other) {
+  merge(other, std::less<value_type>());
+}
 
-  s21::list<value_type> result;
-  int i = 0;
-  int j = 0;
-  int i_size = size();
-  int j_size = other.size();
-  while (i != i_size && j != j_size) {
-    if (other.operator[](j) > operator[](i)) {
-      result.push_back(operator[](i));
-      i++;
-    } else {
-      result.push_back(other.operator[](j));
-      j++;
-    }
+// Relinks the nodes of other into this list: runs of other's elements that
+// go before the current element are spliced in whole. Equal elements keep
+// this list's ones first.
+template <typename T, typename Allocator>
+template <class Compare>
+void list<T, Allocator>::merge(list<T, Allocator> &other, Compare comp) {
+  if (this == &other || other.size_ == 0) return;
+  if (size_ == 0) {
+    takeNodes(other);
+    return;
   }
-  while (i != i_size) {
-    result.push_back(operator[](i));
-    i++;
+
+  NodeBase *current = fake_.pNext;
+  NodeBase *taken = other.fake_.pNext;
+  NodeBase *other_end = &other.fake_;
+  while (current != &fake_ && taken != other_end) {
+    if (!comp(node(taken)->data, node(current)->data)) {
+      current = current->pNext;
+      continue;
+    }
+    NodeBase *run_end = taken->pNext;
+    while (run_end != other_end &&
+           comp(node(run_end)->data, node(current)->data)) {
+      run_end = run_end->pNext;
+    }
+    NodeBase *run_last = run_end->pPrev;
+    taken->pPrev = current->pPrev;
+    current->pPrev->pNext = taken;
+    run_last->pNext = current;
+    current->pPrev = run_last;
+    taken = run_end;
   }
-  while (j != j_size) {
-    result.push_back(other.operator[](j));
-    j++;
+  if (taken != other_end) {
+    NodeBase *run_last = other_end->pPrev;
+    taken->pPrev = fake_.pPrev;
+    fake_.pPrev->pNext = taken;
+    run_last->pNext = &fake_;
+    fake_.pPrev = run_last;
   }
-  *this = result;
-  other.clear();
+
+  size_ += other.size_;
+  other_end->pNext = other_end->pPrev = other_end;
+  other.size_ = 0;
 }
 
-template <typename T>
-void list<T>::splice(list::const_iterator pos, list &other) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(list::const_iterator pos, list &other) {
   if (this == &other || other.size() == 0) return;
+  transfer(pos.get_node(), other.fake_.pNext, &other.fake_);
+  size_ += other.size_;
+  other.size_ = 0;
+}
 
-  Node<value_type> *current_pos = pos.get_node();
+// Moves the element at it in front of pos in O(1).
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(list::const_iterator pos, list &other,
+                                list::const_iterator it) {
+  NodeBase *node = it.get_node();
+  if (node == &other.fake_ || node == pos.get_node() ||
+      node->pNext == pos.get_node()) {
+    return;
+  }
+  transfer(pos.get_node(), node, node->pNext);
+  --other.size_;
+  ++size_;
+}
 
-  other.head_->pPrev = current_pos->pPrev;
-  other.tail_->pNext = current_pos;
+// Moves [first, last) in front of pos. Within one list this is O(1); from
+// another list it walks the range once to keep both sizes right.
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(list::const_iterator pos, list &other,
+                                list::const_iterator first,
+                                list::const_iterator last) {
+  size_type count = 0;
+  if (this != &other) {
+    for (NodeBase *node = first.get_node(); node != last.get_node();
+         node = node->pNext) {
+      ++count;
+    }
+  }
+  splice(pos, other, first, last, count);
+}
 
-  current_pos->pPrev->pNext = other.head_;
-  current_pos->pPrev = other.tail_;
+// O(1) form of the range splice for a caller that already knows the range
+// holds count elements.
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(list::const_iterator pos, list &other,
+                                list::const_iterator first,
+                                list::const_iterator last, size_type count) {
+  if (first == last) return;
+  transfer(pos.get_node(), first.get_node(), last.get_node());
+  if (this != &other) {
+    other.size_ -= count;
+    size_ += count;
+  }
+}
 
-  head_ = fake_->pNext;
-  tail_ = fake_->pPrev;
-  size_ += other.size_;
+template <typename T, typename Allocator>
+void list<T, Allocator>::reverse() {
+  NodeBase *current_node = &fake_;
+  do {
+    std::swap(current_node->pNext, current_node->pPrev);
+    current_node = current_node->pPrev;
+  } while (current_node != &fake_);
+}
 
-  delete other.fake_;
-  other.head_ = other.tail_ = other.fake_ = nullptr;
-  other.size_ = 0;
+template <typename T, typename Allocator>
+void list<T, Allocator>::unique() {
+  unique(std::equal_to<value_type>());
 }
 
-template <typename T>
-void list<T>::reverse() {
-  Node<value_type> *current_node = fake_->pNext;
-  Node<value_type> *temp_node;
-  Node<value_type> *prev_node = current_node->pPrev;
-  while (current_node != fake_) {
-    temp_node = current_node->pNext;
-    current_node->pNext = prev_node;
-    prev_node = current_node;
-    current_node = temp_node;
-  }
-  head_ = prev_node;
-  fake_->pNext = head_;
-}
-
-template <typename T>
-void list<T>::unique() {
-  iterator current(head_);
-  iterator next;
-  while (current != end()) {
-    next = current;
-    ++next;
-    while (next != end()) {
-      if (*current == *next) {
-        next = erase(next);
-      } else {
-        ++next;
-      }
+// Removes every element for which pred(kept, element) holds, where kept is
+// the last element that stayed, so only adjacent runs collapse. One pass.
+template <typename T, typename Allocator>
+template <class BinaryPredicate>
+void list<T, Allocator>::unique(BinaryPredicate pred) {
+  if (size_ <= 1) return;
+  NodeBase *kept = fake_.pNext;
+  NodeBase *current = kept->pNext;
+  while (current != &fake_) {
+    NodeBase *next = current->pNext;
+    if (pred(node(kept)->data, node(current)->data)) {
+      unlink(current);
+      destroyNode(current);
+      --size_;
+    } else {
+      kept = current;
     }
-    ++current;
+    current = next;
   }
 }
 
-template <typename T>
-void list<T>::sort() {
+// Keeps the first occurrence of every value wherever the duplicates are, in
+// expected O(n). The set holds pointers into the surviving nodes, so no
+// element is copied.
+template <typename T, typename Allocator>
+template <class Hash, class KeyEqual>
+void list<T, Allocator>::dedup(Hash hash, KeyEqual equal) {
   if (size_ <= 1) return;
-
-  size_type middle_idx = size_ / 2;
-  size_type second_size = size_ - middle_idx;
-  Node<value_type> *second_head = head_;
-  Node<value_type> *second_end = fake_->pPrev;
-
-  for (size_type i = 0; i < middle_idx; ++i) {
-    second_head = second_head->pNext;
+  auto hash_data = [&hash](const value_type *data) { return hash(*data); };
+  auto equal_data = [&equal](const value_type *a, const value_type *b) {
+    return equal(*a, *b);
+  };
+  std::unordered_set<const value_type *, decltype(hash_data),
+                     decltype(equal_data)>
+      seen(size_, hash_data, equal_data);
+  NodeBase *current = fake_.pNext;
+  while (current != &fake_) {
+    NodeBase *next = current->pNext;
+    if (!seen.insert(&node(current)->data).second) {
+      unlink(current);
+      destroyNode(current);
+      --size_;
+    }
+    current = next;
   }
+}
 
-  tail_ = second_head->pPrev;
-  tail_->pNext = fake_;
-  fake_->pPrev = tail_;
-  size_ = middle_idx;
+template <typename T, typename Allocator>
+void list<T, Allocator>::sort_unique() {
+  sort_unique(std::less<value_type>());
+}
+
+// Sorts, then drops elements equivalent under comp to their predecessor.
+template <typename T, typename Allocator>
+template <class Compare>
+void list<T, Allocator>::sort_unique(Compare comp) {
+  sort(comp);
+  unique([&comp](const value_type &kept, const value_type &element) {
+    return !comp(kept, element);
+  });
+}
 
-  list<T> right_half;
-  right_half.head_ = second_head;
-  right_half.tail_ = second_end;
+template <typename T, typename Allocator>
+void list<T, Allocator>::sort() {
+  sort(std::less<value_type>());
+}
 
-  right_half.fake_->pNext = right_half.head_;
-  right_half.fake_->pPrev = right_half.tail_;
+// Bottom-up merge sort on the pNext chain. bucket[i] holds a sorted run of
+// 2^i nodes or nothing; every node joins as a run of one and carries upward
+// like a binary counter. The pPrev links are rebuilt in one final pass.
+template <typename T, typename Allocator>
+template <class Compare>
+void list<T, Allocator>::sort(Compare comp) {
+  if (size_ <= 1) return;
 
-  right_half.tail_->pNext = right_half.fake_;
-  right_half.head_->pPrev = right_half.fake_;
-  right_half.size_ = second_size;
+  constexpr int kBuckets = std::numeric_limits<size_type>::digits;
+  NodeBase *bucket[kBuckets] = {};
+  int used = 0;
+  fake_.pPrev->pNext = nullptr;
+  NodeBase *rest = fake_.pNext;
+  while (rest != nullptr) {
+    NodeBase *carry = rest;
+    rest = rest->pNext;
+    carry->pNext = nullptr;
+    int i = 0;
+    for (; bucket[i] != nullptr; ++i) {
+      carry = mergeChains(bucket[i], carry, comp);
+      bucket[i] = nullptr;
+    }
+    bucket[i] = carry;
+    if (i == used) ++used;
+  }
+  NodeBase *sorted = nullptr;
+  for (int i = 0; i < used; ++i) {
+    if (bucket[i] != nullptr) sorted = mergeChains(bucket[i], sorted, comp);
+  }
 
-  this->sort();
-  right_half.sort();
+  NodeBase *prev = &fake_;
+  for (NodeBase *node = sorted; node != nullptr; node = node->pNext) {
+    node->pPrev = prev;
+    prev->pNext = node;
+    prev = node;
+  }
+  prev->pNext = &fake_;
+  fake_.pPrev = prev;
+}
 
-  merge(right_half);
+// Merges two null-terminated pNext chains; on ties first's nodes go first.
+template <typename T, typename Allocator>
+template <class Compare>
+NodeBase *list<T, Allocator>::mergeChains(NodeBase *first, NodeBase *second,
+                                          Compare &comp) {
+  NodeBase *merged = nullptr;
+  NodeBase **tail = &merged;
+  while (first != nullptr && second != nullptr) {
+    if (comp(node(second)->data, node(first)->data)) {
+      *tail = second;
+      second = second->pNext;
+    } else {
+      *tail = first;
+      first = first->pNext;
+    }
+    tail = &(*tail)->pNext;
+  }
+  *tail = first != nullptr ? first : second;
+  return merged;
 }
 
-template <typename T>
-typename list<T>::const_iterator list<T>::cbegin() const {
-  return const_iterator(head_);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::cbegin() const {
+  return const_iterator(fake_.pNext);
 }
 
-template <typename T>
-typename list<T>::const_iterator list<T>::cend() const {
-  return const_iterator(fake_);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::cend() const {
+  return const_iterator(sentinel());
 }
 
-template <typename T>
-bool list<T>::operator==(const list<T> &other) const {
+template <typename T, typename Allocator>
+bool list<T, Allocator>::operator==(const list<T, Allocator> &other) const {
   bool is_equal = false;
   is_equal = (size() == other.size());
 
@@ -525,11 +722,16 @@ bool list<T>::operator==(const list<T> &other) const {
   return is_equal;
 }
 
-template <class T>
-bool list<T>::operator!=(const list<T> &other) const {
+template <typename T, typename Allocator>
+bool list<T, Allocator>::operator!=(const list<T, Allocator> &other) const {
   return !(*this == other);
 }
 
+// Takes its nodes from the per-size SlabPool instead of the global heap, for
+// lists and queues that push and pop at a high rate.
+template <class T>
+using pooled_list = list<T, pool_allocator<T>>;
+
 }  // namespace s21
 
 #endif  // CPP_2_S21_CONTAINERS_2_SRC_LIST_S21_LIST_H
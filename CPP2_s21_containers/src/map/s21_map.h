@@ -10,9 +10,12 @@
 #include "../vector/s21_vector.h"
 
 namespace s21 {
-template <typename Key, typename T>
-class map : public AVLTree<Key, T> {
+template <typename Key, typename T, typename Lookup = plain_lookup,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class map : public AVLTree<Key, T, Lookup, Allocator> {
  public:
+  using tree_type = AVLTree<Key, T, Lookup, Allocator>;
+
   class MapIterator;
   class ConstMapIterator;
 
@@ -24,25 +27,34 @@ class map : public AVLTree<Key, T> {
   using iterator = MapIterator;
   using const_iterator = ConstMapIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   map();
-  map(std::initializer_list<value_type> const &items);
+  explicit map(const Allocator &alloc);
+  map(std::initializer_list<value_type> const &items,
+      const Allocator &alloc = Allocator());
   map(const map &m);
   map(map &&m);
   ~map() = default;
 
-  map<Key, T> &operator=(const map &m);
-  map<Key, T> &operator=(map &&m);
+  map<Key, T, Lookup, Allocator> &operator=(const map &m);
+  map<Key, T, Lookup, Allocator> &operator=(map &&m) noexcept(
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value ||
+      std::allocator_traits<Allocator>::is_always_equal::value);
 
   mapped_type &at(const Key &key);
+  const mapped_type &at(const Key &key) const;
   mapped_type &operator[](const Key &key);
 
   iterator begin();
+  const_iterator begin() const;
   iterator end();
+  const_iterator end() const;
 
-  bool empty();
-  size_type size();
-  size_type max_size();
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
 
   void clear();
   std::pair<iterator, bool> insert(const value_type &value);
@@ -52,203 +64,261 @@ class map : public AVLTree<Key, T> {
   void swap(map &other);
   void merge(map &other);
 
-  bool contains(const Key &key);
+  bool contains(const Key &key) const;
 
   template <class... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
 
-  class MapIterator : public AVLTree<Key, T>::Iterator {
+  // Dereferencing yields a snapshot of the element, built from the node on
+  // every call: the tree keeps key and value apart, so there is no stored
+  // pair to refer to. Nothing is shared between iterators.
+  class MapIterator : public tree_type::Iterator {
    public:
-    MapIterator() : AVLTree<Key, T>::Iterator(){};
-    MapIterator(typename AVLTree<Key, T>::Node *node,
-                typename AVLTree<Key, T>::Node *past_node = nullptr)
-        : AVLTree<Key, T>::Iterator(node, past_node = nullptr){};
-    value_type &operator*() {
-      if (AVLTree<Key, T>::Iterator::node_ == nullptr) {
-        static value_type fake = value_type{};
-        return fake;
+    MapIterator() : tree_type::Iterator(){};
+    MapIterator(typename tree_type::Node *node,
+                typename tree_type::Node *past_node = nullptr)
+        : tree_type::Iterator(node, past_node){};
+
+    iterator &operator++() {
+      tree_type::Iterator::operator++();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator temp = *this;
+      tree_type::Iterator::operator++();
+      return temp;
+    }
+
+    iterator &operator--() {
+      tree_type::Iterator::operator--();
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator temp = *this;
+      tree_type::Iterator::operator--();
+      return temp;
+    }
+
+    value_type operator*() const {
+      if (tree_type::Iterator::node_ == nullptr) {
+        return value_type{};
       }
-      std::pair<const key_type, mapped_type> pr =
-          std::make_pair(AVLTree<Key, T>::Iterator::node_->key,
-                         AVLTree<Key, T>::Iterator::node_->value);
-      std::pair<const key_type, mapped_type> &ref = pr;
-      return ref;
+      return value_type(tree_type::Iterator::node_->key,
+                        tree_type::Iterator::node_->value);
     }
   };
 
   class ConstMapIterator : public MapIterator {
    public:
     ConstMapIterator() : MapIterator(){};
-    ConstMapIterator(typename AVLTree<Key, T>::Node *node,
-                     typename AVLTree<Key, T>::Node *past_node = nullptr)
-        : MapIterator(node, past_node = nullptr){};
-    const_reference operator*() const { return MapIterator::operator*(); };
+    ConstMapIterator(typename tree_type::Node *node,
+                     typename tree_type::Node *past_node = nullptr)
+        : MapIterator(node, past_node){};
+    ConstMapIterator(const MapIterator &other) : MapIterator(other){};
   };
 };
 
-template <typename Key, typename T>
-map<Key, T>::map() : AVLTree<Key, T>() {}
+template <typename Key, typename T, typename Lookup, typename Allocator>
+map<Key, T, Lookup, Allocator>::map() : tree_type() {}
 
-template <typename Key, typename T>
-map<Key, T>::map(const std::initializer_list<value_type> &items) {
+template <typename Key, typename T, typename Lookup, typename Allocator>
+map<Key, T, Lookup, Allocator>::map(const Allocator &alloc)
+    : tree_type(alloc) {}
+
+template <typename Key, typename T, typename Lookup, typename Allocator>
+map<Key, T, Lookup, Allocator>::map(
+    const std::initializer_list<value_type> &items, const Allocator &alloc)
+    : tree_type(alloc) {
   for (auto &it : items) {
-    AVLTree<Key, T>::insert(it.first, it.second);
+    tree_type::insert(it.first, it.second);
   }
 }
 
-template <typename Key, typename T>
-map<Key, T>::map(const map<Key, T> &m) : AVLTree<Key, T>(m) {}
+template <typename Key, typename T, typename Lookup, typename Allocator>
+map<Key, T, Lookup, Allocator>::map(const map &m) : tree_type(m) {}
 
-template <typename Key, typename T>
-map<Key, T>::map(map<Key, T> &&m) : AVLTree<Key, T>(std::move(m)) {}
+template <typename Key, typename T, typename Lookup, typename Allocator>
+map<Key, T, Lookup, Allocator>::map(map &&m)
+    : tree_type(std::move(m)) {}
 
-template <typename Key, typename T>
-map<Key, T> &map<Key, T>::operator=(const map<Key, T> &m) {
+template <typename Key, typename T, typename Lookup, typename Allocator>
+map<Key, T, Lookup, Allocator> &map<Key, T, Lookup, Allocator>::operator=(
+    const map &m) {
   if (this != &m) {
-    AVLTree<Key, T>::operator=(m);
+    tree_type::operator=(m);
   }
   return *this;
 }
 
-template <typename Key, typename T>
-map<Key, T> &map<Key, T>::operator=(map<Key, T> &&m) {
+template <typename Key, typename T, typename Lookup, typename Allocator>
+map<Key, T, Lookup, Allocator> &map<Key, T, Lookup, Allocator>::operator=(
+    map &&m) noexcept(
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
   if (this != &m) {
-    AVLTree<Key, T>::operator=(m);
+    tree_type::operator=(std::move(m));
   }
   return *this;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::mapped_type &map<Key, T>::at(const Key &key) {
-  auto it = AVLTree<Key, T>::recursiveFind(AVLTree<Key, T>::root_, key);
+template <typename Key, typename T, typename Lookup, typename Allocator>
+typename map<Key, T, Lookup, Allocator>::mapped_type &
+map<Key, T, Lookup, Allocator>::at(const Key &key) {
+  auto it = tree_type::findNode(key);
   if (it == nullptr) {
     throw std::out_of_range("Out of range. Index exceeds container bounds");
   }
   return it->value;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::mapped_type &map<Key, T>::operator[](const Key &key) {
-  auto it = AVLTree<Key, T>::recursiveFind(AVLTree<Key, T>::root_, key);
+template <typename Key, typename T, typename Lookup, typename Allocator>
+const typename map<Key, T, Lookup, Allocator>::mapped_type &
+map<Key, T, Lookup, Allocator>::at(const Key &key) const {
+  auto it = tree_type::findNode(key);
+  if (it == nullptr) {
+    throw std::out_of_range("Out of range. Index exceeds container bounds");
+  }
+  return it->value;
+}
+
+template <typename Key, typename T, typename Lookup, typename Allocator>
+typename map<Key, T, Lookup, Allocator>::mapped_type &
+map<Key, T, Lookup, Allocator>::operator[](const Key &key) {
+  auto it = tree_type::findNode(key);
   if (it == nullptr) {
     insert(std::make_pair(key, T()));
-    it = AVLTree<Key, T>::recursiveFind(AVLTree<Key, T>::root_, key);
+    it = tree_type::findNode(key);
   }
   return it->value;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::begin() {
-  return map<Key, T>::MapIterator(
-      AVLTree<Key, T>::getMin(AVLTree<Key, T>::root_));
+template <typename Key, typename T, typename Lookup, typename Allocator>
+typename map<Key, T, Lookup, Allocator>::iterator
+map<Key, T, Lookup, Allocator>::begin() {
+  return MapIterator(tree_type::getMin(tree_type::root_));
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::end() {
-  if (AVLTree<Key, T>::root_ == nullptr) return begin();
-  typename AVLTree<Key, T>::Node *last_node =
-      AVLTree<Key, T>::getMax(AVLTree<Key, T>::root_);
+template <typename Key, typename T, typename Lookup, typename Allocator>
+typename map<Key, T, Lookup, Allocator>::const_iterator
+map<Key, T, Lookup, Allocator>::begin() const {
+  return ConstMapIterator(tree_type::getMin(tree_type::root_));
+}
+
+template <typename Key, typename T, typename Lookup, typename Allocator>
+typename map<Key, T, Lookup, Allocator>::iterator
+map<Key, T, Lookup, Allocator>::end() {
+  if (tree_type::root_ == nullptr) return begin();
+  typename tree_type::Node *last_node = tree_type::getMax(tree_type::root_);
   MapIterator fake(nullptr, last_node);
   return fake;
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::empty() {
-  return begin() == nullptr;
+template <typename Key, typename T, typename Lookup, typename Allocator>
+typename map<Key, T, Lookup, Allocator>::const_iterator
+map<Key, T, Lookup, Allocator>::end() const {
+  if (tree_type::root_ == nullptr) return begin();
+  return ConstMapIterator(nullptr, tree_type::getMax(tree_type::root_));
 }
 
-template <typename Key, typename T>
-size_t map<Key, T>::size() {
-  return AVLTree<T, T>::recursiveSize(AVLTree<T, T>::root_);
+template <typename Key, typename T, typename Lookup, typename Allocator>
+bool map<Key, T, Lookup, Allocator>::empty() const {
+  return tree_type::root_ == nullptr;
 }
 
-template <typename Key, typename T>
-size_t map<Key, T>::max_size() {
+template <typename Key, typename T, typename Lookup, typename Allocator>
+size_t map<Key, T, Lookup, Allocator>::size() const {
+  return tree_type::recursiveSize(tree_type::root_);
+}
+
+template <typename Key, typename T, typename Lookup, typename Allocator>
+size_t map<Key, T, Lookup, Allocator>::max_size() const {
   return std::numeric_limits<size_type>::max() /
-         sizeof(typename AVLTree<T, T>::Node);
+         sizeof(typename tree_type::Node);
 }
 
-template <typename Key, typename T>
-void map<Key, T>::clear() {
-  if (AVLTree<T, T>::root_ != nullptr)
-    AVLTree<T, T>::recursiveClear(AVLTree<T, T>::root_);
-  AVLTree<T, T>::root_ = nullptr;
+template <typename Key, typename T, typename Lookup, typename Allocator>
+void map<Key, T, Lookup, Allocator>::clear() {
+  tree_type::clearTree();
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const value_type &value) {
-  AVLTree<Key, T>::insert(value.first, value.second);
+template <typename Key, typename T, typename Lookup, typename Allocator>
+std::pair<typename map<Key, T, Lookup, Allocator>::iterator, bool>
+map<Key, T, Lookup, Allocator>::insert(const value_type &value) {
+  tree_type::insert(value.first, value.second);
   std::pair<MapIterator, bool> return_value;
-  return_value = std::pair<iterator, bool>(
-      AVLTree<Key, T>::recursiveFind(AVLTree<Key, T>::root_, value.first),
-      AVLTree<Key, T>::inserted);
+  return_value = std::pair<iterator, bool>(tree_type::findNode(value.first),
+                                           tree_type::inserted);
   return return_value;
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const Key &key, const T &obj) {
-  AVLTree<Key, T>::insert(key, obj);
+template <typename Key, typename T, typename Lookup, typename Allocator>
+std::pair<typename map<Key, T, Lookup, Allocator>::iterator, bool>
+map<Key, T, Lookup, Allocator>::insert(const Key &key, const T &obj) {
+  tree_type::insert(key, obj);
   std::pair<MapIterator, bool> return_value;
-  return_value = std::pair<iterator, bool>(
-      AVLTree<Key, T>::recursiveFind(AVLTree<Key, T>::root_, key),
-      AVLTree<Key, T>::inserted);
+  return_value =
+      std::pair<iterator, bool>(tree_type::findNode(key), tree_type::inserted);
   return return_value;
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
-    const Key &key, const T &obj) {
-  auto it = AVLTree<Key, T>::recursiveFind(AVLTree<Key, T>::root_, key);
+template <typename Key, typename T, typename Lookup, typename Allocator>
+std::pair<typename map<Key, T, Lookup, Allocator>::iterator, bool>
+map<Key, T, Lookup, Allocator>::insert_or_assign(const Key &key, const T &obj) {
+  auto it = tree_type::findNode(key);
   std::pair<MapIterator, bool> return_value;
   if (it != nullptr) {
-    AVLTree<Key, T>::recursiveClearNode(AVLTree<Key, T>::root_, key);
+    tree_type::root_ = tree_type::recursiveClearNode(tree_type::root_, key);
   }
-  AVLTree<Key, T>::insert(key, obj);
-  return_value = std::pair<iterator, bool>(
-      AVLTree<Key, T>::recursiveFind(AVLTree<Key, T>::root_, key),
-      AVLTree<Key, T>::inserted);
+  tree_type::insert(key, obj);
+  return_value =
+      std::pair<iterator, bool>(tree_type::findNode(key), tree_type::inserted);
   return return_value;
 }
 
-template <typename Key, typename T>
-void map<Key, T>::erase(map::iterator pos) {
-  AVLTree<T, T>::root_ =
-      AVLTree<T, T>::recursiveClearNode(AVLTree<T, T>::root_, (*pos).first);
+template <typename Key, typename T, typename Lookup, typename Allocator>
+void map<Key, T, Lookup, Allocator>::erase(map::iterator pos) {
+  tree_type::root_ =
+      tree_type::recursiveClearNode(tree_type::root_, (*pos).first);
 }
 
-template <typename Key, typename T>
-void map<Key, T>::swap(map<Key, T> &other) {
-  std::swap(AVLTree<T, T>::root_, other.root_);
+template <typename Key, typename T, typename Lookup, typename Allocator>
+void map<Key, T, Lookup, Allocator>::swap(map &other) {
+  tree_type::swapTree(other);
 }
 
-template <typename Key, typename T>
-void map<Key, T>::merge(map<Key, T> &other) {
+template <typename Key, typename T, typename Lookup, typename Allocator>
+void map<Key, T, Lookup, Allocator>::merge(map &other) {
   for (auto it : other) {
-    AVLTree<T, T>::insert(it.first, it.second);
+    tree_type::insert(it.first, it.second);
   }
   other.clear();
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::contains(const Key &key) {
-  typename AVLTree<T, T>::Node *temp =
-      AVLTree<T, T>::recursiveFind(AVLTree<T, T>::root_, key);
+template <typename Key, typename T, typename Lookup, typename Allocator>
+bool map<Key, T, Lookup, Allocator>::contains(const Key &key) const {
+  typename tree_type::Node *temp = tree_type::findNode(key);
   return temp != nullptr;
 }
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Lookup, typename Allocator>
 template <class... Args>
-s21::vector<std::pair<typename map<Key, T>::iterator, bool>>
-map<Key, T>::insert_many(Args &&...args) {
-  s21::vector<std::pair<typename map<Key, T>::iterator, bool>> vec;
+s21::vector<std::pair<typename map<Key, T, Lookup, Allocator>::iterator, bool>>
+map<Key, T, Lookup, Allocator>::insert_many(Args &&...args) {
+  s21::vector<std::pair<iterator, bool>> vec;
   for (const auto &arg : {args...}) {
     vec.push_back(insert(arg));
   }
   return vec;
 }
 
+// Serves repeated lookups of hot keys from a cache in front of the tree,
+// for skewed access patterns where a few keys take most of the traffic.
+template <typename Key, typename T>
+using adaptive_map = map<Key, T, hot_key_cache<>>;
+
 }  // namespace s21
 
 #endif  // CPP2_S21_CONTAINERS_2_SRC_MAP_S21_MAP_H
\ No newline at end of file
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <map>
+#include <thread>
+#include <vector>
+
 #include "s21_map.h"
 
 TEST(map, ConstructorDefault) {
@@ -212,3 +216,168 @@ TEST(map, FunctionMerge) {
     EXPECT_TRUE((*my_it).second == (*it).second);
   }
 }
+
+TEST(map, ConstReadApi) {
+  const s21::map<int, int> my_map = {{3, 30}, {1, 10}, {2, 20}};
+  const std::map<int, int> map = {{3, 30}, {1, 10}, {2, 20}};
+  EXPECT_FALSE(my_map.empty());
+  EXPECT_EQ(my_map.size(), map.size());
+  EXPECT_TRUE(my_map.contains(2));
+  EXPECT_FALSE(my_map.contains(4));
+  EXPECT_EQ(my_map.at(3), map.at(3));
+  EXPECT_THROW(my_map.at(4), std::out_of_range);
+  auto it = map.begin();
+  for (auto my_it = my_map.begin(); my_it != my_map.end(); ++my_it, ++it) {
+    EXPECT_EQ((*my_it).first, (*it).first);
+    EXPECT_EQ((*my_it).second, (*it).second);
+  }
+}
+
+TEST(map, IteratorPostfixReturnsPreviousPosition) {
+  s21::map<int, int> my_map = {{1, 2}, {2, 3}, {3, 4}};
+  auto my_it = my_map.begin();
+  auto first = my_it++;
+  auto second = my_it++;
+  EXPECT_EQ((*first).first, 1);
+  EXPECT_EQ((*second).first, 2);
+  EXPECT_EQ((*my_it).first, 3);
+  auto third = my_it--;
+  EXPECT_EQ((*third).first, 3);
+  EXPECT_EQ((*my_it).first, 2);
+}
+
+TEST(map, CopyIsIndependentOfSource) {
+  auto *source = new s21::map<int, int>{{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+  s21::map<int, int> copy(*source);
+  delete source;
+  int expected = 1;
+  for (auto it = copy.begin(); it != copy.end(); ++it, ++expected) {
+    EXPECT_EQ((*it).first, expected);
+  }
+  EXPECT_EQ(expected, 5);
+}
+
+TEST(map, ConcurrentReadersOnFrozenMap) {
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 1000; ++i) my_map.insert(i, i * 2);
+  const s21::map<int, int> &frozen = my_map;
+
+  std::vector<long> sums(4, 0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([&frozen, &sums, t] {
+      long sum = 0;
+      for (auto it = frozen.begin(); it != frozen.end(); it++) {
+        sum += (*it).second;
+      }
+      for (int i = 0; i < 1000; ++i) {
+        if (frozen.contains(i)) sum += frozen.at(i);
+      }
+      sums[t] = sum;
+    });
+  }
+  for (auto &reader : readers) reader.join();
+  for (long sum : sums) EXPECT_EQ(sum, 2L * 999 * 1000);
+}
+
+TEST(map, StaysBalancedOnOrderedInserts) {
+  struct Probe : s21::map<int, int> {
+    int height() const { return root_->height; }
+  };
+  Probe ascending;
+  Probe zigzag;
+  for (int i = 0; i < 1023; ++i) {
+    ascending.insert(i, i);
+    zigzag.insert(i % 2 == 0 ? i : 2000 - i, i);
+  }
+  EXPECT_EQ(ascending.height(), 10);
+  EXPECT_LE(zigzag.height(), 14);
+  EXPECT_EQ(zigzag.size(), 1023U);
+}
+
+TEST(map, AdaptiveMatchesPlainUnderChurn) {
+  s21::adaptive_map<int, int> my_map;
+  std::map<int, int> map;
+  unsigned state = 12345;
+  for (int i = 0; i < 20000; ++i) {
+    state = state * 1103515245U + 12345U;
+    int key = static_cast<int>((state >> 8) % 512);
+    if (i % 3 == 0) {
+      my_map.insert_or_assign(key, i);
+      map[key] = i;
+    } else if (i % 3 == 1 && my_map.contains(key)) {
+      my_map.erase(my_map.insert(key, 0).first);
+      map.erase(key);
+    }
+    ASSERT_EQ(my_map.contains(key), map.count(key) == 1);
+    if (map.count(key)) {
+      ASSERT_EQ(my_map.at(key), map[key]);
+    }
+  }
+  EXPECT_EQ(my_map.size(), map.size());
+}
+
+TEST(map, AdaptiveForgetsClearedAndSwappedTrees) {
+  s21::adaptive_map<int, int> first = {{1, 10}, {2, 20}};
+  s21::adaptive_map<int, int> second = {{3, 30}};
+  EXPECT_EQ(first.at(1), 10);
+  EXPECT_EQ(second.at(3), 30);
+  first.swap(second);
+  EXPECT_FALSE(first.contains(1));
+  EXPECT_EQ(first.at(3), 30);
+  EXPECT_EQ(second.at(1), 10);
+  s21::adaptive_map<int, int> copy(second);
+  second.clear();
+  EXPECT_FALSE(second.contains(1));
+  EXPECT_EQ(copy.at(2), 20);
+  EXPECT_THROW(second.at(2), std::out_of_range);
+}
+
+TEST(map, AdaptiveMoveCarriesTheCache) {
+  s21::adaptive_map<int, int> source;
+  for (int i = 0; i < 100; ++i) source.insert(i, i);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(source.at(i), i);
+
+  s21::adaptive_map<int, int> moved(std::move(source));
+  EXPECT_EQ(moved.at(42), 42);
+  moved.erase(moved.insert(42, 0).first);
+  EXPECT_FALSE(moved.contains(42));
+
+  s21::adaptive_map<int, int> assigned = {{7, 70}};
+  EXPECT_EQ(assigned.at(7), 70);
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned.at(7), 7);
+  assigned.erase(assigned.insert(7, 0).first);
+  EXPECT_FALSE(assigned.contains(7));
+  EXPECT_FALSE(assigned.contains(42));
+  EXPECT_EQ(assigned.size(), 98U);
+
+  // The moved-from maps start over with no table of their own.
+  EXPECT_FALSE(source.contains(1));
+  EXPECT_FALSE(moved.contains(1));
+  source.insert(1, 11);
+  EXPECT_EQ(source.at(1), 11);
+  EXPECT_EQ(assigned.at(1), 1);
+}
+
+TEST(map, AdaptiveConcurrentReadersOnFrozenMap) {
+  s21::adaptive_map<int, int> my_map;
+  for (int i = 0; i < 1000; ++i) my_map.insert(i, i * 2);
+  const s21::adaptive_map<int, int> &frozen = my_map;
+
+  std::vector<long> sums(4, 0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([&frozen, &sums, t] {
+      long sum = 0;
+      for (int round = 0; round < 4; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+          if (frozen.contains(i)) sum += frozen.at(i);
+        }
+      }
+      sums[t] = sum;
+    });
+  }
+  for (auto &reader : readers) reader.join();
+  for (long sum : sums) EXPECT_EQ(sum, 4L * 999 * 1000);
+}
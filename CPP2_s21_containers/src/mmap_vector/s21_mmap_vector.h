@@ -0,0 +1,313 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_MMAP_VECTOR_S21_MMAP_VECTOR_H
+#define CPP2_S21_CONTAINERS_2_SRC_MMAP_VECTOR_S21_MMAP_VECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Vector of trivially copyable records kept in a shared memory mapping of a
+// file. The file is a bare array of records with no header, so existing
+// binary dumps open as they are: opening costs one mmap() whatever the file
+// size, and pages are read in by the kernel when first touched. Writes land
+// in the page cache and reach the file when the kernel writes them back, at
+// flush() or at the latest when the file is closed.
+//
+// Growth extends the file with ftruncate() and the mapping with mremap()
+// (a fresh mmap() where mremap() is missing), doubling like vector. Spare
+// capacity is cut off the file again by close() and the destructor; a
+// process that dies before that leaves zeroed records at the end.
+//
+// A default-constructed mmap_vector uses an anonymous mapping instead of a
+// file. Iterators are plain pointers and are invalidated by growth.
+template <typename T>
+class mmap_vector {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mmap_vector stores records as raw bytes");
+
+  // read_write creates a missing file; truncate also empties an existing
+  // one. A read_only vector throws std::logic_error from every member that
+  // would change it, and writes through data() fault.
+  enum class open_mode { read_only, read_write, truncate };
+
+  // Forwarded to madvise() and kept across growth.
+  enum class access { normal, sequential, random, will_need };
+
+  mmap_vector() noexcept = default;
+
+  explicit mmap_vector(const std::string &path,
+                       open_mode mode = open_mode::read_write) {
+    int flags = mode == open_mode::read_only ? O_RDONLY : O_RDWR | O_CREAT;
+    if (mode == open_mode::truncate) flags |= O_TRUNC;
+    fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+    if (fd_ < 0) throwErrno("open");
+    writable_ = mode != open_mode::read_only;
+    try {
+      struct stat info;
+      if (::fstat(fd_, &info) != 0) throwErrno("fstat");
+      std::size_t bytes = static_cast<std::size_t>(info.st_size);
+      if (bytes % sizeof(value_type) != 0) {
+        throw std::runtime_error(
+            "mmap_vector: file size is not a multiple of the record size");
+      }
+      if (bytes > 0) map(bytes / sizeof(value_type));
+    } catch (...) {
+      ::close(fd_);  // not close(): that would truncate the file
+      throw;
+    }
+    size_ = capacity_;
+  }
+
+  mmap_vector(const mmap_vector &) = delete;
+  mmap_vector &operator=(const mmap_vector &) = delete;
+
+  mmap_vector(mmap_vector &&other) noexcept { swap(other); }
+
+  mmap_vector &operator=(mmap_vector &&other) noexcept {
+    if (this != &other) {
+      close();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~mmap_vector() { close(); }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Out of range");
+    return data_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Out of range");
+    return data_[pos];
+  }
+
+  reference operator[](size_type pos) { return data_[pos]; }
+  const_reference operator[](size_type pos) const { return data_[pos]; }
+  reference front() { return data_[0]; }
+  const_reference front() const { return data_[0]; }
+  reference back() { return data_[size_ - 1]; }
+  const_reference back() const { return data_[size_ - 1]; }
+  iterator data() { return data_; }
+  const_iterator data() const { return data_; }
+
+  iterator begin() { return data_; }
+  const_iterator begin() const { return data_; }
+  const_iterator cbegin() const { return data_; }
+  iterator end() { return data_ + size_; }
+  const_iterator end() const { return data_ + size_; }
+  const_iterator cend() const { return data_ + size_; }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+  size_type capacity() const { return capacity_; }
+  // True when the records live in a file rather than anonymous memory.
+  bool is_open() const { return fd_ >= 0; }
+
+  void reserve(size_type size) {
+    if (size > max_size()) throw std::exception();
+    if (size > capacity_) resizeMapping(size);
+  }
+
+  void shrink_to_fit() {
+    if (capacity_ != size_) resizeMapping(size_);
+  }
+
+  // Keeps the capacity; the file shrinks when it is closed.
+  void clear() {
+    requireWritable();
+    size_ = 0;
+  }
+
+  void push_back(const_reference value) {
+    if (size_ == capacity_) {
+      value_type copy = value;  // value may live in the old mapping
+      reserve(std::max(capacity_ * 2, pageSize() / sizeof(value_type) + 1));
+      new (data_ + size_) value_type(copy);
+    } else {
+      requireWritable();
+      new (data_ + size_) value_type(value);
+    }
+    ++size_;
+  }
+
+  void pop_back() {
+    requireWritable();
+    if (size_ != 0) --size_;
+  }
+
+  void swap(mmap_vector &other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(fd_, other.fd_);
+    std::swap(writable_, other.writable_);
+    std::swap(hint_, other.hint_);
+  }
+
+  // Writes the dirty pages holding records back to the file, waiting for
+  // the disk unless async is set. Does nothing for an anonymous vector.
+  void flush(bool async = false) {
+    if (fd_ < 0 || size_ == 0) return;
+    if (::msync(data_, size_ * sizeof(value_type),
+                async ? MS_ASYNC : MS_SYNC) != 0) {
+      throwErrno("msync");
+    }
+  }
+
+  void advise(access hint) {
+    hint_ = hint;
+    applyHint();
+  }
+
+  // Unmaps, trims the file to size() records and closes it, leaving an
+  // empty anonymous vector. Errors are ignored, as in the destructor.
+  void close() noexcept {
+    if (data_ != nullptr) ::munmap(data_, capacity_ * sizeof(value_type));
+    if (fd_ >= 0) {
+      if (writable_) {
+        int ignored = ::ftruncate(
+            fd_, static_cast<off_t>(size_ * sizeof(value_type)));
+        (void)ignored;
+      }
+      ::close(fd_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+    fd_ = -1;
+    writable_ = true;
+    hint_ = access::normal;
+  }
+
+ private:
+  static std::size_t pageSize() {
+    static const std::size_t size =
+        static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+  }
+
+  int protection() const {
+    return writable_ ? PROT_READ | PROT_WRITE : PROT_READ;
+  }
+
+  int mapFlags() const {
+    return fd_ >= 0 ? MAP_SHARED : MAP_PRIVATE | MAP_ANONYMOUS;
+  }
+
+  void requireWritable() const {
+    if (!writable_) throw std::logic_error("mmap_vector: opened read-only");
+  }
+
+  void map(size_type n) {
+    void *address = ::mmap(nullptr, n * sizeof(value_type), protection(),
+                           mapFlags(), fd_, 0);
+    if (address == MAP_FAILED) throwErrno("mmap");
+    data_ = static_cast<value_type *>(address);
+    capacity_ = n;
+    applyHint();
+  }
+
+  void applyHint() {
+    if (data_ == nullptr) return;
+    int advice = MADV_NORMAL;
+    switch (hint_) {
+      case access::sequential:
+        advice = MADV_SEQUENTIAL;
+        break;
+      case access::random:
+        advice = MADV_RANDOM;
+        break;
+      case access::will_need:
+        advice = MADV_WILLNEED;
+        break;
+      case access::normal:
+        break;
+    }
+    // Only a hint: a kernel that rejects it still maps the data correctly.
+    ::madvise(data_, capacity_ * sizeof(value_type), advice);
+  }
+
+  // The file grows before the mapping does and shrinks after it, so no
+  // mapped page ever lies past the end of the file.
+  void resizeMapping(size_type n) {
+    requireWritable();
+    std::size_t old_bytes = capacity_ * sizeof(value_type);
+    std::size_t new_bytes = n * sizeof(value_type);
+    if (n > capacity_) truncateFile(new_bytes);
+    if (data_ == nullptr) {
+      map(n);
+    } else if (n == 0) {
+      ::munmap(data_, old_bytes);
+      data_ = nullptr;
+      capacity_ = 0;
+    } else {
+      data_ = remap(old_bytes, new_bytes);
+      capacity_ = n;
+      applyHint();
+    }
+    if (new_bytes < old_bytes) truncateFile(new_bytes);
+  }
+
+  void truncateFile(std::size_t bytes) {
+    if (fd_ >= 0 && ::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+      throwErrno("ftruncate");
+    }
+  }
+
+  value_type *remap(std::size_t old_bytes, std::size_t new_bytes) {
+#ifdef MREMAP_MAYMOVE
+    void *address = ::mremap(data_, old_bytes, new_bytes, MREMAP_MAYMOVE);
+    if (address == MAP_FAILED) throwErrno("mremap");
+#else
+    void *address =
+        ::mmap(nullptr, new_bytes, protection(), mapFlags(), fd_, 0);
+    if (address == MAP_FAILED) throwErrno("mmap");
+    if (fd_ < 0) std::memcpy(address, data_, size_ * sizeof(value_type));
+    ::munmap(data_, old_bytes);
+#endif
+    return static_cast<value_type *>(address);
+  }
+
+  [[noreturn]] static void throwErrno(const char *call) {
+    throw std::system_error(errno, std::generic_category(),
+                            std::string("mmap_vector: ") + call);
+  }
+
+  value_type *data_ = nullptr;
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+  int fd_ = -1;
+  bool writable_ = true;
+  access hint_ = access::normal;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_MMAP_VECTOR_S21_MMAP_VECTOR_H
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "../simd/s21_simd.h"
+#include "s21_mmap_vector.h"
+
+namespace {
+
+struct Record {
+  std::int32_t id;
+  float score;
+  std::int64_t stamp;
+};
+
+// A file under /tmp that is removed when the test ends.
+class TempFile {
+ public:
+  explicit TempFile(const std::string &tag)
+      : path_("/tmp/s21_mmap_vector_" + tag + "_" +
+              std::to_string(::getpid())) {
+    std::remove(path_.c_str());
+  }
+  ~TempFile() { std::remove(path_.c_str()); }
+
+  const std::string &path() const { return path_; }
+
+  long size() const {
+    std::ifstream in(path_, std::ios::binary | std::ios::ate);
+    return in ? static_cast<long>(in.tellg()) : -1;
+  }
+
+ private:
+  std::string path_;
+};
+
+Record makeRecord(int i) {
+  return {i, static_cast<float>(i) / 2, std::int64_t{i} * 1000};
+}
+
+}  // namespace
+
+TEST(MmapVector, AnonymousGrowsLikeVector) {
+  s21::mmap_vector<int> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_FALSE(v.is_open());
+  for (int i = 0; i < 100000; ++i) v.push_back(i * 3);
+  EXPECT_EQ(v.size(), 100000U);
+  EXPECT_GE(v.capacity(), v.size());
+  EXPECT_EQ(v.front(), 0);
+  EXPECT_EQ(v.back(), 99999 * 3);
+  EXPECT_EQ(v.at(500), 1500);
+  EXPECT_THROW(v.at(100000), std::out_of_range);
+  EXPECT_EQ(v.end() - v.begin(), 100000);
+
+  v.push_back(v[7]);  // the argument lives inside the mapping
+  EXPECT_EQ(v.back(), 21);
+  v.pop_back();
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 100000U);
+  EXPECT_EQ(v[99999], 99999 * 3);
+  v.clear();
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 0U);
+  EXPECT_EQ(v.data(), nullptr);
+}
+
+TEST(MmapVector, FileRoundTrip) {
+  TempFile file("round_trip");
+  {
+    s21::mmap_vector<Record> v(file.path(),
+                               s21::mmap_vector<Record>::open_mode::truncate);
+    EXPECT_TRUE(v.is_open());
+    for (int i = 0; i < 5000; ++i) v.push_back(makeRecord(i));
+    v.flush();
+  }
+  EXPECT_EQ(file.size(), static_cast<long>(5000 * sizeof(Record)));
+
+  const s21::mmap_vector<Record> v(
+      file.path(), s21::mmap_vector<Record>::open_mode::read_only);
+  ASSERT_EQ(v.size(), 5000U);
+  EXPECT_EQ(v.capacity(), 5000U);
+  for (int i = 0; i < 5000; i += 97) {
+    EXPECT_EQ(v[i].id, i);
+    EXPECT_FLOAT_EQ(v[i].score, i / 2.0f);
+    EXPECT_EQ(v[i].stamp, i * 1000);
+  }
+}
+
+TEST(MmapVector, OpensExistingRawArrays) {
+  TempFile file("raw");
+  {
+    std::ofstream out(file.path(), std::ios::binary);
+    for (std::int32_t i = 0; i < 1000; ++i) {
+      out.write(reinterpret_cast<const char *>(&i), sizeof(i));
+    }
+  }
+  {
+    s21::mmap_vector<std::int32_t> v(file.path());
+    v.advise(s21::mmap_vector<std::int32_t>::access::sequential);
+    ASSERT_EQ(v.size(), 1000U);
+    EXPECT_EQ(v[999], 999);
+    v[10] = -10;
+    v.push_back(1000);
+    v.advise(s21::mmap_vector<std::int32_t>::access::random);
+    v.flush(true);
+  }
+  EXPECT_EQ(file.size(), 1001 * 4);
+  std::ifstream in(file.path(), std::ios::binary);
+  std::int32_t values[11];
+  in.read(reinterpret_cast<char *>(values), sizeof(values));
+  EXPECT_EQ(values[10], -10);
+  EXPECT_EQ(values[9], 9);
+}
+
+TEST(MmapVector, SpareCapacityIsTrimmedOnClose) {
+  TempFile file("trim");
+  s21::mmap_vector<std::int64_t> v(file.path());
+  v.reserve(10000);
+  v.push_back(1);
+  v.push_back(2);
+  EXPECT_EQ(file.size(), static_cast<long>(10000 * sizeof(std::int64_t)));
+  v.close();
+  EXPECT_FALSE(v.is_open());
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(file.size(), 16);
+
+  s21::mmap_vector<std::int64_t> reopened(file.path());
+  EXPECT_EQ(reopened.size(), 2U);
+  reopened.shrink_to_fit();
+  reopened.pop_back();
+  reopened.shrink_to_fit();
+  EXPECT_EQ(file.size(), 8);
+  EXPECT_EQ(reopened.back(), 1);
+}
+
+TEST(MmapVector, ReadOnlyRejectsChanges) {
+  TempFile file("read_only");
+  {
+    s21::mmap_vector<int> v(file.path());
+    v.push_back(4);
+  }
+  s21::mmap_vector<int> v(file.path(),
+                          s21::mmap_vector<int>::open_mode::read_only);
+  EXPECT_THROW(v.push_back(5), std::logic_error);
+  EXPECT_THROW(v.reserve(100), std::logic_error);
+  EXPECT_THROW(v.pop_back(), std::logic_error);
+  EXPECT_THROW(v.clear(), std::logic_error);
+  EXPECT_EQ(v.size(), 1U);
+  v.close();
+  EXPECT_EQ(file.size(), 4);
+}
+
+TEST(MmapVector, OpenErrors) {
+  TempFile missing("missing");
+  EXPECT_THROW(s21::mmap_vector<int>(
+                   missing.path(), s21::mmap_vector<int>::open_mode::read_only),
+               std::system_error);
+
+  TempFile odd("odd");
+  {
+    std::ofstream out(odd.path(), std::ios::binary);
+    out << "12345";
+  }
+  EXPECT_THROW(s21::mmap_vector<int>{odd.path()}, std::runtime_error);
+  EXPECT_EQ(odd.size(), 5);
+}
+
+TEST(MmapVector, MoveAndSwapTransferTheMapping) {
+  TempFile file("move");
+  s21::mmap_vector<int> a(file.path());
+  a.push_back(1);
+  a.push_back(2);
+  const int *records = a.data();
+
+  s21::mmap_vector<int> b(std::move(a));
+  EXPECT_EQ(b.data(), records);
+  EXPECT_TRUE(b.is_open());
+  EXPECT_TRUE(a.empty());
+  EXPECT_FALSE(a.is_open());
+
+  s21::mmap_vector<int> c;
+  c.push_back(9);
+  c.swap(b);
+  EXPECT_EQ(c.size(), 2U);
+  EXPECT_EQ(b.front(), 9);
+  b = std::move(c);
+  EXPECT_EQ(b[1], 2);
+  EXPECT_TRUE(b.is_open());
+}
+
+TEST(MmapVector, WorksWithSimdScans) {
+  s21::mmap_vector<std::int32_t> v;
+  for (std::int32_t i = 0; i < 4000; ++i) v.push_back(i % 100);
+  EXPECT_EQ(s21::simd::count(v, 42), 40U);
+  EXPECT_EQ(s21::simd::find(v, 99), v.begin() + 99);
+  EXPECT_EQ(s21::simd::accumulate(v, 0), 40 * 4950);
+}
@@ -36,7 +36,7 @@ TEST(MultisetCtor, copyCtor) {
 
   auto s21x = s21ms.begin();
   auto x = ms.begin();
-  while (x != s21ms.end()) {
+  while (x != ms.end()) {
     EXPECT_EQ(*s21x, *x);
     ++s21x;
     ++x;
@@ -64,11 +64,44 @@ TEST(MultisetOperators, minusOperator) {
   auto x = s21ms.end();
 
   while (x != s21ms.begin()) {
-    EXPECT_TRUE(s21ms.contains(*x));
     --x;
+    EXPECT_TRUE(s21ms.contains(*x));
   }
 }
 
+TEST(MultisetOperators, scansVisitEveryCopy) {
+  s21::multiset<int> s21ms = {3, 1, 2, 2, 7, 2, 1};
+  std::multiset<int> ms = {3, 1, 2, 2, 7, 2, 1};
+
+  auto x = ms.begin();
+  size_t visited = 0;
+  for (int value : s21ms) {
+    EXPECT_EQ(value, *x++);
+    ++visited;
+  }
+  EXPECT_EQ(visited, ms.size());
+
+  const s21::multiset<int> &cs21ms = s21ms;
+  auto rx = ms.rbegin();
+  for (auto it = cs21ms.end(); it != cs21ms.begin();) {
+    --it;
+    EXPECT_EQ(*it, *rx++);
+  }
+  EXPECT_TRUE(rx == ms.rend());
+
+  s21::multiset<int> source = {5, 5, 6};
+  s21::multiset<int> target = {1};
+  target.merge(source);
+  EXPECT_EQ(target.size(), 4U);
+  EXPECT_EQ(target.count(5), 2U);
+  EXPECT_TRUE(source.empty());
+
+  s21::multiset<int> copy(s21ms);
+  visited = 0;
+  for (auto it = copy.begin(); it != copy.end(); ++it) ++visited;
+  EXPECT_EQ(visited, ms.size());
+}
+
 TEST(MultisetOperators, plusAndStarOperators) {
   s21::multiset<int> s21ms;
   auto x = s21ms.begin();
@@ -231,10 +264,10 @@ TEST(MultisetMethods, erase_test_1) {
   s21ms.erase(s21x2);
 
   ms.erase(2);
-  ms.erase(22);
+  ms.erase(18);
 
   EXPECT_EQ(s21ms.count(2), ms.count(2));
-  EXPECT_EQ(s21ms.count(22), ms.count(22));
+  EXPECT_EQ(s21ms.count(18), ms.count(18));
 
   EXPECT_EQ(s21ms.size(), ms.size());
 }
@@ -477,3 +510,27 @@ TEST(MultisetMethods, insert_many) {
 
   EXPECT_TRUE(*x == s21ms.find(1002));
 }
+
+TEST(MultisetMethods, constReadApi) {
+  const s21::multiset<int> s21ms = {5, 1, 3, 3, 3};
+  const std::multiset<int> ms = {5, 1, 3, 3, 3};
+  EXPECT_FALSE(s21ms.empty());
+  EXPECT_EQ(s21ms.size(), ms.size());
+  EXPECT_EQ(s21ms.count(3), ms.count(3));
+  EXPECT_TRUE(s21ms.contains(5));
+  EXPECT_FALSE(s21ms.contains(2));
+  EXPECT_EQ(*s21ms.find(1), 1);
+  EXPECT_EQ(*s21ms.begin(), *ms.begin());
+}
+
+TEST(MultisetMethods, copyKeepsDuplicates) {
+  s21::multiset<int> s21ms = {2, 2, 2, 7};
+  s21::multiset<int> copy(s21ms);
+  EXPECT_EQ(copy.size(), s21ms.size());
+  EXPECT_EQ(copy.count(2), 3U);
+}
+
+TEST(MultisetMethods, singleElementIsNotEmpty) {
+  s21::multiset<int> s21ms = {42};
+  EXPECT_FALSE(s21ms.empty());
+}
@@ -2,13 +2,18 @@
 #define CPP2_S21_CONTAINERS_2_SRC_MULTISET_S21_MAVLTREE_H
 
 #include <iostream>
+#include <memory>
+#include <utility>
+
+#include "../allocator/s21_allocator_propagation.h"
 
 #define ZERO 0
 #define UNIT 1
 
 namespace s21 {
 
-template <typename Key, typename Value>
+template <typename Key, typename Value,
+          typename Allocator = std::allocator<Value>>
 class MAVLTree {
  protected:
   struct Node;
@@ -24,6 +29,7 @@ class MAVLTree {
   using iterator = Iterator;
   using const_iterator = ConstIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   class Iterator {
    public:
@@ -32,7 +38,7 @@ class MAVLTree {
     Iterator(Node *node, Node *past_node = nullptr)
         : node_(node), past_node_(past_node){};
 
-    Node *moveBack(Node *node) {
+    static Node *moveBack(Node *node) {
       if (node->left != nullptr) {
         return getMax(node->left);
       }
@@ -64,38 +70,42 @@ class MAVLTree {
       return *this;
     }
 
-    iterator &operator++(int) {
-      static iterator temp = *this;
+    iterator operator++(int) {
+      iterator temp = *this;
       operator++();
       return temp;
     }
 
     iterator &operator--() {
       if (node_ == nullptr && past_node_ != nullptr) {
-        *this = past_node_;
+        node_ = past_node_;
         return *this;
       }
       node_ = moveBack(node_);
       return *this;
     }
 
-    iterator &operator--(int) {
-      static iterator temp = *this;
+    iterator operator--(int) {
+      iterator temp = *this;
       operator--();
       return temp;
     }
 
-    reference operator*() {
+    const_reference operator*() const {
       if (node_ == nullptr) {
-        static Value fake = Value{};
+        static const Value fake = Value{};
         return fake;
       }
       return node_->value;
     }
 
-    bool operator==(const Iterator &other) { return node_ == other.node_; }
+    bool operator==(const Iterator &other) const {
+      return node_ == other.node_;
+    }
 
-    bool operator!=(const Iterator &other) { return node_ != other.node_; }
+    bool operator!=(const Iterator &other) const {
+      return node_ != other.node_;
+    }
 
    protected:
     Node *node_;
@@ -110,9 +120,15 @@ class MAVLTree {
 
   MAVLTree() : root_(nullptr) {}
 
-  MAVLTree(const MAVLTree &other) { root_ = copyTree(other.root_); }
+  explicit MAVLTree(const Allocator &alloc) : root_(nullptr), alloc_(alloc) {}
+
+  MAVLTree(const MAVLTree &other)
+      : alloc_(node_traits::select_on_container_copy_construction(
+            other.alloc_)) {
+    root_ = copyTree(other.root_, nullptr);
+  }
 
-  MAVLTree(MAVLTree &&other) {
+  MAVLTree(MAVLTree &&other) : alloc_(std::move(other.alloc_)) {
     root_ = other.root_;
     other.root_ = nullptr;
   }
@@ -122,6 +138,8 @@ class MAVLTree {
     root_ = nullptr;
   }
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
   void insert(const Key &key, const Value &value) {
     root_ = recursiveInsert(root_, key, value);
   }
@@ -136,7 +154,7 @@ class MAVLTree {
     Node *right;
     Node *parent;
 
-    Node(Key &key, Value &value)
+    Node(const Key &key, const Value &value)
         : key(key),
           value(value),
           height(UNIT),
@@ -144,39 +162,88 @@ class MAVLTree {
           left(nullptr),
           right(nullptr),
           parent(nullptr) {}
+
+    Node(const Key &key, Value &&value)
+        : key(key),
+          value(std::move(value)),
+          height(UNIT),
+          count(UNIT),
+          left(nullptr),
+          right(nullptr),
+          parent(nullptr) {}
   };
 
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
   Node *root_;
+  node_allocator alloc_;
 
-  MAVLTree &operator=(MAVLTree &&other) {
+  // Takes other's nodes when the allocators allow it, else moves the
+  // elements one by one into nodes of its own.
+  MAVLTree &operator=(MAVLTree &&other) noexcept(
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value) {
     if (this != &other) {
-      root_ = other.root_;
-      other.root_ = nullptr;
+      clearTree();
+      if (canStealOnMoveAssign(alloc_, other.alloc_)) {
+        propagateOnMoveAssign(alloc_, other.alloc_);
+        root_ = std::exchange(other.root_, nullptr);
+      } else {
+        root_ = moveTree(other.root_, nullptr);
+        other.clearTree();
+      }
     }
     return *this;
   }
 
   MAVLTree &operator=(const MAVLTree &other) {
     if (this != &other) {
-      MAVLTree temp(other);
-      recursiveClear(root_);
-      *this = std::move(temp);
+      clearTree();
+      propagateOnCopyAssign(alloc_, other.alloc_);
+      root_ = copyTree(other.root_, nullptr);
     }
     return *this;
   }
 
-  int getHeight(Node *node) { return node == nullptr ? ZERO : node->height; }
+  void clearTree() {
+    if (root_ != nullptr) recursiveClear(root_);
+    root_ = nullptr;
+  }
+
+  void swapTree(MAVLTree &other) {
+    propagateOnSwap(alloc_, other.alloc_);
+    std::swap(root_, other.root_);
+  }
+
+  template <typename V>
+  Node *createNode(const Key &key, V &&value) {
+    Node *node = node_traits::allocate(alloc_, 1);
+    try {
+      node_traits::construct(alloc_, node, key, std::forward<V>(value));
+    } catch (...) {
+      node_traits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroyNode(Node *node) {
+    node_traits::destroy(alloc_, node);
+    node_traits::deallocate(alloc_, node, 1);
+  }
+
+  int getHeight(Node *node) const { return node == nullptr ? ZERO : node->height; }
 
   void updateHeight(Node *node) {
     if (node) {
       node->height =
           std::max(getHeight(node->left), getHeight(node->right)) + 1;
-      updateHeight(node->left);
-      updateHeight(node->right);
     }
   }
 
-  int getBalance(Node *node) {
+  int getBalance(Node *node) const {
     return node == nullptr ? ZERO
                            : getHeight(node->left) - getHeight(node->right);
   }
@@ -212,17 +279,15 @@ class MAVLTree {
   Node *balance(Node *node) {
     int getBal = getBalance(node);
     if (getBal > 1) {
-      if (getBalance(node->right) != -1) {
-        node = rightRotation(node);
-      } else {
-        node = leftRotation(node);
+      if (getBalance(node->left) < 0) {
+        node->left = leftRotation(node->left);
       }
+      node = rightRotation(node);
     } else if (getBal < -1) {
-      if (getBalance(node->left) != 1) {
-        node = leftRotation(node);
-      } else {
-        node = rightRotation(node);
+      if (getBalance(node->right) > 0) {
+        node->right = rightRotation(node->right);
       }
+      node = leftRotation(node);
     }
     return node;
   }
@@ -238,9 +303,9 @@ class MAVLTree {
     return getMin(node->left);
   }
 
-  Node *recursiveInsert(Node *node, Key key, Value value) {
+  Node *recursiveInsert(Node *node, const Key &key, const Value &value) {
     if (node == nullptr) {
-      Node *temp = new Node(key, value);
+      Node *temp = createNode(key, value);
       return temp;
     }
     if (key < node->key) {
@@ -269,7 +334,7 @@ class MAVLTree {
         Node *dupl_node = node;
         node = (node->left == nullptr) ? node->right : node->left;
         if (node != nullptr) node->parent = node_parent;
-        delete dupl_node;
+        destroyNode(dupl_node);
       } else {
         Node *maxInLeft = getMax(node->left);
         node->key = maxInLeft->key;
@@ -285,14 +350,14 @@ class MAVLTree {
     return node;
   }
 
-  Node *recursiveFind(Node *node, Key key) {
+  Node *recursiveFind(Node *node, const Key &key) const {
     if (node == nullptr) return nullptr;
     if (node->key == key) return node;
     return (key < node->key) ? recursiveFind(node->left, key)
                              : recursiveFind(node->right, key);
   }
 
-  Node *findRight(Node *node, const Key fkey) {
+  Node *findRight(Node *node, const Key fkey) const {
     Node *fNode = nullptr;
 
     if (node->right != nullptr) {
@@ -315,7 +380,7 @@ class MAVLTree {
     return fNode;
   }
 
-  Node *findLeft(Node *node, const Key fkey) {
+  Node *findLeft(Node *node, const Key fkey) const {
     Node *fNode = nullptr;
 
     if (node->left != nullptr) {
@@ -339,7 +404,7 @@ class MAVLTree {
     return fNode;
   }
 
-  Node *findRange(Node *node, const Key fkey) {
+  Node *findRange(Node *node, const Key fkey) const {
     if (fkey < getMin(node)->key) return getMin(node);
     if (fkey > getMax(node)->key) return getMax(node);
 
@@ -357,10 +422,10 @@ class MAVLTree {
     if (node == nullptr) return;
     if (node->left != nullptr) recursiveClear(node->left);
     if (node->right != nullptr) recursiveClear(node->right);
-    delete node;
+    destroyNode(node);
   }
 
-  size_type recursiveSize(Node *node) {
+  size_type recursiveSize(Node *node) const {
     if (node == nullptr) return ZERO;
     size_type Count = ZERO;
     Count += node->count;
@@ -369,12 +434,27 @@ class MAVLTree {
     return Count;
   }
 
-  Node *copyTree(Node *node) {
+  Node *copyTree(Node *node, Node *parent) {
+    if (node == nullptr) return nullptr;
+    Node *new_node = createNode(node->key, node->value);
+    new_node->height = node->height;
+    new_node->count = node->count;
+    new_node->parent = parent;
+    new_node->left = copyTree(node->left, new_node);
+    new_node->right = copyTree(node->right, new_node);
+    return new_node;
+  }
+
+  // Like copyTree, but moves the values out. Keys are copied, so node's
+  // tree stays ordered if a move throws.
+  Node *moveTree(Node *node, Node *parent) {
     if (node == nullptr) return nullptr;
-    Node *new_node = new Node(node->key, node->value);
-    new_node->left = copyTree(node->left);
-    new_node->right = copyTree(node->right);
-    new_node->parent = node->parent;
+    Node *new_node = createNode(node->key, std::move(node->value));
+    new_node->height = node->height;
+    new_node->count = node->count;
+    new_node->parent = parent;
+    new_node->left = moveTree(node->left, new_node);
+    new_node->right = moveTree(node->right, new_node);
     return new_node;
   }
 };
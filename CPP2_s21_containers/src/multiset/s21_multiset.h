@@ -1,6 +1,7 @@
 #ifndef CPP2_S21_CONTAINERS_2_SRC_MULTISET_S21_MULTISET_H
 #define CPP2_S21_CONTAINERS_2_SRC_MULTISET_S21_MULTISET_H
 
+#include <cstddef>
 #include <initializer_list>
 #include <limits>
 
@@ -9,9 +10,11 @@
 
 namespace s21 {
 
-template <typename Key>
-class multiset : public MAVLTree<Key, Key> {
+template <typename Key, typename Allocator = std::allocator<Key>>
+class multiset : public MAVLTree<Key, Key, Allocator> {
  public:
+  using tree_type = MAVLTree<Key, Key, Allocator>;
+
   class MultisetIterator;
   class ConstMultisetIterator;
 
@@ -22,21 +25,27 @@ class multiset : public MAVLTree<Key, Key> {
   using iterator = MultisetIterator;
   using const_iterator = ConstMultisetIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
-  class MultisetIterator : public MAVLTree<Key, Key> {
+  // Equal keys share a node that counts them, so an iterator is a node
+  // plus the index of one copy within it; a scan visits every copy. end()
+  // has no node but remembers the maximum, so --end() reaches it.
+  class MultisetIterator {
    public:
-    typename MAVLTree<Key, Key>::Node *node_;
+    typename tree_type::Node *node_;
 
-    MultisetIterator() : node_(nullptr){};
-    MultisetIterator(typename MAVLTree<Key, Key>::Node *node) : node_(node){};
+    MultisetIterator() : node_(nullptr), copy_(0), last_(nullptr){};
+    MultisetIterator(typename tree_type::Node *node,
+                     typename tree_type::Node *last = nullptr)
+        : node_(node), copy_(0), last_(last){};
     ~MultisetIterator() = default;
 
-    typename MAVLTree<Key, Key>::Node *moveBack(
-        typename MAVLTree<Key, Key>::Node *node) {
+    static typename tree_type::Node *moveBack(
+        typename tree_type::Node *node) {
       if (node->left != nullptr) {
-        return MAVLTree<Key, Key>::getMax(node->left);
+        return tree_type::getMax(node->left);
       }
-      typename MAVLTree<Key, Key>::Node *parent = node->parent;
+      typename tree_type::Node *parent = node->parent;
       while (parent != nullptr && node == parent->left) {
         node = parent;
         parent = node->parent;
@@ -46,13 +55,19 @@ class multiset : public MAVLTree<Key, Key> {
 
     iterator &operator++() {
       if (node_ != nullptr) {
+        if (copy_ + 1 < node_->count) {
+          ++copy_;
+          return *this;
+        }
+        copy_ = 0;
+        last_ = node_;
         if (node_->right != nullptr) {
           node_ = node_->right;
           while (node_->left != nullptr) {
             node_ = node_->left;
           }
         } else {
-          typename MAVLTree<Key, Key>::Node *parent = node_->parent;
+          typename tree_type::Node *parent = node_->parent;
           while (parent != nullptr && node_ == parent->right) {
             node_ = parent;
             parent = parent->parent;
@@ -64,63 +79,86 @@ class multiset : public MAVLTree<Key, Key> {
       return *this;
     }
 
-    iterator &operator++(int) {
-      static iterator temp = *this;
+    iterator operator++(int) {
+      iterator temp = *this;
       operator++();
       return temp;
     }
 
     iterator &operator--() {
-      node_ = moveBack(node_);
+      if (node_ == nullptr) {
+        node_ = last_;
+      } else if (copy_ > 0) {
+        --copy_;
+        return *this;
+      } else {
+        node_ = moveBack(node_);
+      }
+      copy_ = node_ != nullptr ? node_->count - 1 : 0;
       return *this;
     }
 
-    iterator &operator--(int) {
-      static iterator temp = *this;
+    iterator operator--(int) {
+      iterator temp = *this;
       operator--();
       return temp;
     }
 
-    reference operator*() {
+    const_reference operator*() const {
       if (node_ == nullptr) {
-        static Key fake = Key{};
+        static const Key fake = Key{};
         return fake;
       }
 
       return node_->value;
     }
 
-    bool operator==(const MultisetIterator &other) {
-      return node_ == other.node_;
+    bool operator==(const MultisetIterator &other) const {
+      return node_ == other.node_ && copy_ == other.copy_;
     }
 
-    bool operator!=(const MultisetIterator &other) {
-      return node_ != other.node_;
+    bool operator!=(const MultisetIterator &other) const {
+      return !(*this == other);
     }
+
+   private:
+    std::size_t copy_;
+    typename tree_type::Node *last_;
   };
 
   class ConstMultisetIterator : public MultisetIterator {
    public:
     ConstMultisetIterator() : MultisetIterator(){};
-    const_reference operator*() const { return MultisetIterator::operator*(); }
+    ConstMultisetIterator(typename tree_type::Node *node,
+                          typename tree_type::Node *last = nullptr)
+        : MultisetIterator(node, last){};
+    ConstMultisetIterator(const MultisetIterator &other)
+        : MultisetIterator(other){};
   };
 
   multiset();
-  multiset(std::initializer_list<value_type> const &items);
+  explicit multiset(const Allocator &alloc);
+  multiset(std::initializer_list<value_type> const &items,
+           const Allocator &alloc = Allocator());
   multiset(const multiset &ms);
   multiset(multiset &&ms);
 
   ~multiset() = default;
 
-  multiset<Key> &operator=(const multiset &ms);
-  multiset<Key> &operator=(multiset &&ms);
+  multiset<Key, Allocator> &operator=(const multiset &ms);
+  multiset<Key, Allocator> &operator=(multiset &&ms) noexcept(
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value ||
+      std::allocator_traits<Allocator>::is_always_equal::value);
 
   iterator begin();
+  const_iterator begin() const;
   iterator end();
+  const_iterator end() const;
 
-  bool empty();
-  size_type size();
-  size_type max_size();
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
 
   void clear();
   iterator insert(const value_type &value);
@@ -128,186 +166,213 @@ class multiset : public MAVLTree<Key, Key> {
   void swap(multiset &other);
   void merge(multiset &other);
 
-  size_type count(const Key &key);
+  size_type count(const Key &key) const;
   iterator find(const Key &key);
-  bool contains(const Key &key);
+  const_iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
   std::pair<iterator, iterator> equal_range(const Key &key);
   iterator lower_bound(const Key &key);
   iterator upper_bound(const Key &key);
 
   template <typename... Args>
-  s21::vector<typename multiset<Key>::iterator> insert_many(Args &&...args);
+  s21::vector<iterator> insert_many(Args &&...args);
 };
 
-template <typename Key>
-multiset<Key>::multiset() : MAVLTree<Key, Key>() {}
+template <typename Key, typename Allocator>
+multiset<Key, Allocator>::multiset() : tree_type() {}
+
+template <typename Key, typename Allocator>
+multiset<Key, Allocator>::multiset(const Allocator &alloc) : tree_type(alloc) {}
 
-template <typename Key>
-multiset<Key>::multiset(std::initializer_list<value_type> const &items) {
+template <typename Key, typename Allocator>
+multiset<Key, Allocator>::multiset(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : tree_type(alloc) {
   for (auto &it : items) {
-    MAVLTree<Key, Key>::insert(it, it);
+    tree_type::insert(it, it);
   }
 }
 
-template <typename Key>
-multiset<Key>::multiset(const multiset &ms) : MAVLTree<Key, Key>(ms) {}
+template <typename Key, typename Allocator>
+multiset<Key, Allocator>::multiset(const multiset &ms) : tree_type(ms) {}
 
-template <typename Key>
-multiset<Key>::multiset(multiset &&ms) : MAVLTree<Key, Key>(std::move(ms)) {}
+template <typename Key, typename Allocator>
+multiset<Key, Allocator>::multiset(multiset &&ms) : tree_type(std::move(ms)) {}
 
-template <typename Key>
-multiset<Key> &multiset<Key>::operator=(const multiset &ms) {
+template <typename Key, typename Allocator>
+multiset<Key, Allocator> &multiset<Key, Allocator>::operator=(
+    const multiset &ms) {
   if (this != &ms) {
-    MAVLTree<Key, Key>::operator=(ms);
+    tree_type::operator=(ms);
   }
 
   return *this;
 }
 
-template <typename Key>
-multiset<Key> &multiset<Key>::operator=(multiset &&ms) {
+template <typename Key, typename Allocator>
+multiset<Key, Allocator> &multiset<Key, Allocator>::operator=(
+    multiset &&ms) noexcept(
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
   if (this != &ms) {
-    MAVLTree<Key, Key>::operator=(ms);
+    tree_type::operator=(std::move(ms));
   }
 
   return *this;
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::begin() {
-  return iterator(MAVLTree<Key, Key>::getMin(MAVLTree<Key, Key>::root_));
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::begin() {
+  return iterator(tree_type::getMin(tree_type::root_));
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::end() {
-  if (MAVLTree<Key, Key>::root_ == nullptr)
-    return begin();
-  else
-    return iterator(MAVLTree<Key, Key>::getMax(MAVLTree<Key, Key>::root_));
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::end() {
+  if (tree_type::root_ == nullptr) return iterator();
+  return iterator(nullptr, tree_type::getMax(tree_type::root_));
+}
+
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::const_iterator
+multiset<Key, Allocator>::begin() const {
+  return const_iterator(tree_type::getMin(tree_type::root_));
 }
 
-template <typename Key>
-bool multiset<Key>::empty() {
-  return (this->begin() == this->end());
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::const_iterator
+multiset<Key, Allocator>::end() const {
+  if (tree_type::root_ == nullptr) return const_iterator();
+  return const_iterator(nullptr, tree_type::getMax(tree_type::root_));
 }
 
-template <typename Key>
-size_t multiset<Key>::size() {
-  return MAVLTree<Key, Key>::recursiveSize(MAVLTree<Key, Key>::root_);
+template <typename Key, typename Allocator>
+bool multiset<Key, Allocator>::empty() const {
+  return tree_type::root_ == nullptr;
 }
 
-template <typename Key>
-size_t multiset<Key>::max_size() {
+template <typename Key, typename Allocator>
+size_t multiset<Key, Allocator>::size() const {
+  return tree_type::recursiveSize(tree_type::root_);
+}
+
+template <typename Key, typename Allocator>
+size_t multiset<Key, Allocator>::max_size() const {
   return std::numeric_limits<size_type>::max() /
-         sizeof(typename MAVLTree<Key, Key>::Node);
+         sizeof(typename tree_type::Node);
 }
 
-template <typename Key>
-void multiset<Key>::clear() {
-  if (MAVLTree<Key, Key>::root_ != nullptr)
-    MAVLTree<Key, Key>::recursiveClear(MAVLTree<Key, Key>::root_);
+template <typename Key, typename Allocator>
+void multiset<Key, Allocator>::clear() {
+  if (tree_type::root_ != nullptr)
+    tree_type::recursiveClear(tree_type::root_);
 
-  MAVLTree<Key, Key>::root_ = nullptr;
+  tree_type::root_ = nullptr;
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::insert(
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::insert(
     const value_type &value) {
-  MAVLTree<Key, Key>::insert(value, value);
+  tree_type::insert(value, value);
   iterator return_value = find(value);
   return return_value;
 }
 
-template <typename Key>
-void multiset<Key>::erase(iterator pos) {
-  MAVLTree<Key, Key>::root_ =
-      MAVLTree<Key, Key>::recursiveClearNode(MAVLTree<Key, Key>::root_, *pos);
+template <typename Key, typename Allocator>
+void multiset<Key, Allocator>::erase(iterator pos) {
+  tree_type::root_ = tree_type::recursiveClearNode(tree_type::root_, *pos);
 }
 
-template <typename Key>
-void multiset<Key>::swap(multiset<Key> &other) {
-  std::swap(MAVLTree<Key, Key>::root_, other.root_);
+template <typename Key, typename Allocator>
+void multiset<Key, Allocator>::swap(multiset<Key, Allocator> &other) {
+  tree_type::swapTree(other);
 }
 
-template <typename Key>
-void multiset<Key>::merge(multiset<Key> &other) {
+template <typename Key, typename Allocator>
+void multiset<Key, Allocator>::merge(multiset<Key, Allocator> &other) {
   for (auto it = other.begin(); it != other.end(); it++) {
-    MAVLTree<Key, Key>::insert(*it, *it);
+    tree_type::insert(*it, *it);
   }
   other.clear();
 }
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::count(const Key &key) {
-  typename MAVLTree<Key, Key>::Node *node =
-      MAVLTree<Key, Key>::recursiveFind(MAVLTree<Key, Key>::root_, key);
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::size_type multiset<Key, Allocator>::count(
+    const Key &key) const {
+  typename tree_type::Node *node =
+      tree_type::recursiveFind(tree_type::root_, key);
   size_type x = ZERO;
 
   return (node != nullptr) ? node->count : x;
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::find(const Key &key) {
-  typename MAVLTree<Key, Key>::Node *node =
-      MAVLTree<Key, Key>::recursiveFind(MAVLTree<Key, Key>::root_, key);
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::find(
+    const Key &key) {
+  typename tree_type::Node *node =
+      tree_type::recursiveFind(tree_type::root_, key);
 
   iterator find(node);
   return find;
 }
 
-template <typename Key>
-bool multiset<Key>::contains(const Key &key) {
-  iterator it = find(key);
-  return (it != nullptr) ? true : false;
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::const_iterator
+multiset<Key, Allocator>::find(const Key &key) const {
+  return const_iterator(tree_type::recursiveFind(tree_type::root_, key));
+}
+
+template <typename Key, typename Allocator>
+bool multiset<Key, Allocator>::contains(const Key &key) const {
+  return tree_type::recursiveFind(tree_type::root_, key) != nullptr;
 }
 
-template <typename Key>
-std::pair<typename multiset<Key>::iterator, typename multiset<Key>::iterator>
-multiset<Key>::equal_range(const Key &key) {
-  std::pair<typename multiset<Key>::iterator, typename multiset<Key>::iterator>
-      result;
+template <typename Key, typename Allocator>
+std::pair<typename multiset<Key, Allocator>::iterator,
+          typename multiset<Key, Allocator>::iterator>
+multiset<Key, Allocator>::equal_range(const Key &key) {
+  std::pair<iterator, iterator> result;
 
-  typename MAVLTree<Key, Key>::Node *node =
-      MAVLTree<Key, Key>::recursiveFind(MAVLTree<Key, Key>::root_, key);
+  typename tree_type::Node *node =
+      tree_type::recursiveFind(tree_type::root_, key);
 
   if (node == nullptr) {
-    node = MAVLTree<Key, Key>::findRange(MAVLTree<Key, Key>::root_, key);
+    node = tree_type::findRange(tree_type::root_, key);
     result.first.node_ = result.second.node_ = node;
   } else {
     result.first.node_ = node;
-    result.second.node_ =
-        MAVLTree<Key, Key>::findRange(MAVLTree<Key, Key>::root_, node->key);
+    result.second.node_ = tree_type::findRange(tree_type::root_, node->key);
   }
 
   return result;
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::lower_bound(const Key &key) {
-  if (key > MAVLTree<Key, Key>::getMax(MAVLTree<Key, Key>::root_)->key)
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator
+multiset<Key, Allocator>::lower_bound(const Key &key) {
+  if (key > tree_type::getMax(tree_type::root_)->key)
     throw std::out_of_range("lower_bound: Too big key\n");
 
-  typename MAVLTree<Key, Key>::Node *node =
-      MAVLTree<Key, Key>::recursiveFind(MAVLTree<Key, Key>::root_, key);
+  typename tree_type::Node *node =
+      tree_type::recursiveFind(tree_type::root_, key);
 
   iterator result;
 
   if (node != nullptr)
     result.node_ = node;
   else
-    result.node_ =
-        MAVLTree<Key, Key>::findRange(MAVLTree<Key, Key>::root_, key);
+    result.node_ = tree_type::findRange(tree_type::root_, key);
 
   return result;
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::upper_bound(const Key &key) {
-  if (key > MAVLTree<Key, Key>::getMax(MAVLTree<Key, Key>::root_)->key)
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator
+multiset<Key, Allocator>::upper_bound(const Key &key) {
+  if (key > tree_type::getMax(tree_type::root_)->key)
     throw std::out_of_range("upper_bound: Too big key\n");
 
-  typename MAVLTree<Key, Key>::Node *node =
-      MAVLTree<Key, Key>::findRange(MAVLTree<Key, Key>::root_, key);
+  typename tree_type::Node *node = tree_type::findRange(tree_type::root_, key);
 
   iterator result;
 
@@ -316,11 +381,11 @@ typename multiset<Key>::iterator multiset<Key>::upper_bound(const Key &key) {
   return result;
 }
 
-template <typename Key>
+template <typename Key, typename Allocator>
 template <typename... Args>
-s21::vector<typename multiset<Key>::iterator> multiset<Key>::insert_many(
-    Args &&...args) {
-  s21::vector<typename multiset<Key>::iterator> vec;
+s21::vector<typename multiset<Key, Allocator>::iterator>
+multiset<Key, Allocator>::insert_many(Args &&...args) {
+  s21::vector<iterator> vec;
   for (const auto &arg : {args...}) {
     vec.push_back(insert(arg));
   }
@@ -0,0 +1,131 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_PMR_S21_ARENA_RESOURCE_H
+#define CPP2_S21_CONTAINERS_2_SRC_PMR_S21_ARENA_RESOURCE_H
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+namespace s21 {
+
+// Bump-pointer memory resource for objects that die together. Allocation
+// advances a pointer through the current chunk; deallocate() does nothing,
+// and release() (or the destructor) hands every chunk back to upstream at
+// once. Chunks come from upstream and double in size, so a long-lived
+// arena touches upstream O(log n) times for n bytes.
+//
+// An optional caller-supplied buffer is used first and is never freed, which
+// lets a request handler keep its arena entirely on the stack.
+//
+// Not thread-safe: share one arena per thread or per request.
+class arena_resource : public std::pmr::memory_resource {
+ public:
+  explicit arena_resource(
+      std::size_t chunk_size = kDefaultChunk,
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+      : upstream_(upstream),
+        chunks_(nullptr),
+        buffer_(nullptr),
+        buffer_size_(0),
+        current_(nullptr),
+        space_(0),
+        first_chunk_(chunk_size < kMinChunk ? kMinChunk : chunk_size),
+        next_chunk_(first_chunk_) {}
+
+  arena_resource(
+      void *buffer, std::size_t size,
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+      : arena_resource(size, upstream) {
+    buffer_ = buffer;
+    buffer_size_ = size;
+    current_ = buffer;
+    space_ = size;
+  }
+
+  arena_resource(const arena_resource &) = delete;
+  arena_resource &operator=(const arena_resource &) = delete;
+
+  ~arena_resource() override { release(); }
+
+  // Frees every chunk and rewinds to the initial buffer, if any. Memory
+  // handed out before the call must no longer be used.
+  void release() noexcept {
+    while (chunks_ != nullptr) {
+      Chunk *prev = chunks_->prev;
+      upstream_->deallocate(chunks_, chunks_->size, alignof(Chunk));
+      chunks_ = prev;
+    }
+    current_ = buffer_;
+    space_ = buffer_size_;
+    next_chunk_ = first_chunk_;
+  }
+
+  std::pmr::memory_resource *upstream_resource() const { return upstream_; }
+
+ protected:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    if (bytes == 0) bytes = 1;
+    void *ptr = std::align(alignment, bytes, current_, space_);
+    if (ptr == nullptr) {
+      grow(bytes, alignment);
+      ptr = std::align(alignment, bytes, current_, space_);
+    }
+    current_ = static_cast<char *>(ptr) + bytes;
+    space_ -= bytes;
+    return ptr;
+  }
+
+  void do_deallocate(void *, std::size_t, std::size_t) override {}
+
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+ private:
+  static constexpr std::size_t kDefaultChunk = 4096;
+  static constexpr std::size_t kMinChunk = 256;
+  static constexpr std::size_t kMaxChunk =
+      std::numeric_limits<std::size_t>::max();
+
+  // Sits at the start of every upstream block.
+  struct alignas(std::max_align_t) Chunk {
+    Chunk *prev;
+    std::size_t size;
+  };
+
+  // Starts a chunk big enough for bytes at alignment; the rest of the
+  // current chunk is abandoned. Requests for more than half the address
+  // space are refused rather than doubled past it.
+  void grow(std::size_t bytes, std::size_t alignment) {
+    std::size_t need = sizeof(Chunk) + bytes + alignment;
+    if (need < bytes) throw std::bad_alloc();
+    std::size_t size = next_chunk_;
+    while (size < need) {
+      if (size > kMaxChunk / 2) throw std::bad_alloc();
+      size *= 2;
+    }
+    Chunk *chunk =
+        static_cast<Chunk *>(upstream_->allocate(size, alignof(Chunk)));
+    chunk->prev = chunks_;
+    chunk->size = size;
+    chunks_ = chunk;
+    current_ = chunk + 1;
+    space_ = size - sizeof(Chunk);
+    next_chunk_ = size > kMaxChunk / 2 ? size : size * 2;
+  }
+
+  std::pmr::memory_resource *upstream_;
+  Chunk *chunks_;
+  void *buffer_;
+  std::size_t buffer_size_;
+  void *current_;
+  std::size_t space_;
+  std::size_t first_chunk_;
+  std::size_t next_chunk_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_PMR_S21_ARENA_RESOURCE_H
@@ -0,0 +1,41 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_PMR_S21_PMR_H
+#define CPP2_S21_CONTAINERS_2_SRC_PMR_S21_PMR_H
+
+#include <memory_resource>
+#include <utility>
+
+#include "../list/s21_list.h"
+#include "../map/s21_map.h"
+#include "../multiset/s21_multiset.h"
+#include "../set/s21_set.h"
+#include "../vector/s21_vector.h"
+#include "s21_arena_resource.h"
+
+namespace s21 {
+
+// Containers drawing memory from a std::pmr::memory_resource chosen at run
+// time, as std::pmr does for the standard ones. Copies fall back to the
+// default resource and assignment never moves the allocator, so a container
+// always returns memory to the resource it came from.
+namespace pmr {
+
+template <typename T>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+
+template <typename Key, typename T, typename Lookup = plain_lookup>
+using map = s21::map<Key, T, Lookup,
+                     std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+
+template <typename T, typename Lookup = plain_lookup>
+using set = s21::set<T, Lookup, std::pmr::polymorphic_allocator<T>>;
+
+template <typename Key>
+using multiset = s21::multiset<Key, std::pmr::polymorphic_allocator<Key>>;
+
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_PMR_S21_PMR_H
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+#include "s21_pmr.h"
+
+namespace {
+
+// Forwards to new/delete and keeps count of what is outstanding.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t calls = 0;
+  std::size_t live = 0;
+
+ protected:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++calls;
+    live += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void *ptr, std::size_t bytes,
+                     std::size_t alignment) override {
+    live -= bytes;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+bool aligned(void *ptr, std::size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(ArenaResource, BumpsThroughChunksAndReleasesAtOnce) {
+  CountingResource upstream;
+  s21::arena_resource arena(1024, &upstream);
+  void *first = arena.allocate(24, 8);
+  void *second = arena.allocate(24, 8);
+  EXPECT_EQ(static_cast<char *>(second) - static_cast<char *>(first), 24);
+  EXPECT_EQ(upstream.calls, 1U);
+  for (int i = 0; i < 1000; ++i) EXPECT_NE(arena.allocate(40, 8), nullptr);
+  EXPECT_LT(upstream.calls, 8U);
+  arena.deallocate(first, 24, 8);
+  arena.release();
+  EXPECT_EQ(upstream.live, 0U);
+  EXPECT_NE(arena.allocate(8, 8), nullptr);
+  EXPECT_EQ(upstream.live, 1024U);
+}
+
+TEST(ArenaResource, HonoursAlignmentAndLargeRequests) {
+  CountingResource upstream;
+  {
+    s21::arena_resource arena(256, &upstream);
+    EXPECT_NE(arena.allocate(1, 1), nullptr);
+    EXPECT_TRUE(aligned(arena.allocate(16, 64), 64));
+    EXPECT_TRUE(aligned(arena.allocate(3, 4), 4));
+    void *big = arena.allocate(100000, 16);
+    EXPECT_TRUE(aligned(big, 16));
+    static_cast<char *>(big)[99999] = 1;
+  }
+  EXPECT_EQ(upstream.live, 0U);
+}
+
+TEST(ArenaResource, UsesTheCallerBufferFirst) {
+  CountingResource upstream;
+  alignas(std::max_align_t) unsigned char buffer[512];
+  s21::arena_resource arena(buffer, sizeof(buffer), &upstream);
+  void *ptr = arena.allocate(256, 8);
+  EXPECT_GE(static_cast<unsigned char *>(ptr), buffer);
+  EXPECT_LT(static_cast<unsigned char *>(ptr), buffer + sizeof(buffer));
+  EXPECT_EQ(upstream.calls, 0U);
+  EXPECT_NE(arena.allocate(512, 8), nullptr);
+  EXPECT_EQ(upstream.calls, 1U);
+  arena.release();
+  EXPECT_EQ(arena.allocate(8, 8), static_cast<void *>(buffer));
+  EXPECT_EQ(upstream.live, 0U);
+}
+
+TEST(ArenaResource, RefusesRequestsPastHalfTheAddressSpace) {
+  CountingResource upstream;
+  s21::arena_resource arena(1024, &upstream);
+  // Volatile keeps the compiler from flagging the sizes as impossible.
+  volatile std::size_t max = std::numeric_limits<std::size_t>::max();
+  EXPECT_THROW(static_cast<void>(arena.allocate(max / 2 + 2, 8)),
+               std::bad_alloc);
+  EXPECT_THROW(static_cast<void>(arena.allocate(max - 8, 8)), std::bad_alloc);
+  EXPECT_EQ(upstream.calls, 0U);
+  EXPECT_NE(arena.allocate(64, 8), nullptr);
+  EXPECT_EQ(upstream.live, 1024U);
+}
+
+TEST(PmrContainers, DrawFromTheGivenResource) {
+  CountingResource upstream;
+  {
+    s21::arena_resource arena(4096, &upstream);
+    s21::pmr::vector<int> v(&arena);
+    s21::pmr::list<int> l(&arena);
+    s21::pmr::map<int, int> m(&arena);
+    s21::pmr::set<int> s(&arena);
+    s21::pmr::multiset<int> ms(&arena);
+    for (int i = 0; i < 100; ++i) {
+      v.push_back(i);
+      l.push_back(i);
+      m.insert(i, i * i);
+      s.insert(i);
+      ms.insert(i % 10);
+    }
+    EXPECT_EQ(v.get_allocator().resource(), &arena);
+    EXPECT_EQ(m.get_allocator().resource(), &arena);
+    EXPECT_EQ(m.at(7), 49);
+    EXPECT_EQ(ms.count(3), 10U);
+    EXPECT_LT(upstream.calls, 8U);
+  }
+  EXPECT_EQ(upstream.live, 0U);
+}
+
+TEST(PmrContainers, KeepTheirResourceAcrossCopyAndAssign) {
+  s21::arena_resource a, b;
+  s21::pmr::vector<int> source({1, 2, 3}, &a);
+  s21::pmr::vector<int> copy(source);
+  EXPECT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+
+  s21::pmr::vector<int> target(&b);
+  target = std::move(source);
+  EXPECT_EQ(target.get_allocator().resource(), &b);
+  ASSERT_EQ(target.size(), 3U);
+  EXPECT_EQ(target[1], 2);
+
+  s21::pmr::map<int, int> m1({{1, 1}}, &a);
+  s21::pmr::map<int, int> m2(&b);
+  m2 = m1;
+  EXPECT_EQ(m2.get_allocator().resource(), &b);
+  EXPECT_TRUE(m2.contains(1));
+}
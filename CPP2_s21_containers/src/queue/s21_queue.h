@@ -2,19 +2,27 @@
 #define CPP2_S21_CONTAINERS_2_SRC_QUEUE_S21_QUEUE_H
 
 #include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 #include "../list/s21_list.h"
 
 namespace s21 {
-template <class T>
+template <class T, class Container = list<T>>
 class queue {
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
+  using container_type = Container;
 
   queue();
+  // Builds the underlying container with alloc, as std::queue does.
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  explicit queue(const Alloc &alloc);
   queue(std::initializer_list<value_type> const &items);
   queue(const queue &q);
   queue(queue &&q);
@@ -29,6 +37,9 @@ class queue {
   size_type size();
 
   void push(const_reference value);
+  void push(value_type &&value);
+  template <class... Args>
+  void emplace(Args &&...args);
   void pop();
   void swap(queue &other);
 
@@ -36,80 +47,95 @@ class queue {
   void insert_many_back(Args &&...args);
 
  private:
-  list<value_type> list_;
+  Container list_;
 };
 
-template <typename T>
-queue<T>::queue() {}
+template <typename T, typename Container>
+queue<T, Container>::queue() {}
+
+template <typename T, typename Container>
+template <class Alloc, class>
+queue<T, Container>::queue(const Alloc &alloc) : list_(alloc) {}
 
-template <typename T>
-queue<T>::queue(const std::initializer_list<value_type> &items) {
+template <typename T, typename Container>
+queue<T, Container>::queue(const std::initializer_list<value_type> &items) {
   list_.clear();
   for (auto i : items) {
     list_.push_back(i);
   }
 }
 
-template <typename T>
-queue<T>::queue(const queue<T> &q) {
+template <typename T, typename Container>
+queue<T, Container>::queue(const queue<T, Container> &q) {
   list_ = q.list_;
 }
 
-template <typename T>
-queue<T>::queue(queue<T> &&q) {
+template <typename T, typename Container>
+queue<T, Container>::queue(queue<T, Container> &&q) {
   operator=(std::move(q));
 }
 
-template <typename T>
-queue<T>::~queue() {
+template <typename T, typename Container>
+queue<T, Container>::~queue() {
   list_.clear();
 }
 
-template <typename T>
-queue<T> &queue<T>::operator=(queue<T> &&q) {
+template <typename T, typename Container>
+queue<T, Container> &queue<T, Container>::operator=(queue<T, Container> &&q) {
   list_ = std::move(q.list_);
   return *this;
 }
 
-template <typename T>
-typename queue<T>::const_reference queue<T>::front() {
+template <typename T, typename Container>
+typename queue<T, Container>::const_reference queue<T, Container>::front() {
   return list_.front();
 }
 
-template <typename T>
-typename queue<T>::const_reference queue<T>::back() {
+template <typename T, typename Container>
+typename queue<T, Container>::const_reference queue<T, Container>::back() {
   return list_.back();
 }
 
-template <typename T>
-bool queue<T>::empty() {
+template <typename T, typename Container>
+bool queue<T, Container>::empty() {
   return list_.empty();
 }
 
-template <typename T>
-size_t queue<T>::size() {
+template <typename T, typename Container>
+size_t queue<T, Container>::size() {
   return list_.size();
 }
 
-template <typename T>
-void queue<T>::push(const_reference value) {
+template <typename T, typename Container>
+void queue<T, Container>::push(const_reference value) {
   list_.push_back(value);
 }
 
-template <typename T>
-void queue<T>::pop() {
+template <typename T, typename Container>
+void queue<T, Container>::push(value_type &&value) {
+  list_.push_back(std::move(value));
+}
+
+template <typename T, typename Container>
+template <class... Args>
+void queue<T, Container>::emplace(Args &&...args) {
+  list_.emplace_back(std::forward<Args>(args)...);
+}
+
+template <typename T, typename Container>
+void queue<T, Container>::pop() {
   list_.pop_front();
 }
 
-template <typename T>
-void queue<T>::swap(queue<T> &other) {
+template <typename T, typename Container>
+void queue<T, Container>::swap(queue<T, Container> &other) {
   list_.swap(other.list_);
 }
 
-template <typename T>
+template <typename T, typename Container>
 template <class... Args>
-void queue<T>::insert_many_back(Args &&...args) {
-  list_.insert_many_back(args...);
+void queue<T, Container>::insert_many_back(Args &&...args) {
+  list_.insert_many_back(std::forward<Args>(args)...);
 }
 
 }  // namespace s21
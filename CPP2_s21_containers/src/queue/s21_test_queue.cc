@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <queue>
+#include <string>
 
 #include "s21_queue.h"
 
@@ -162,3 +164,55 @@ TEST(Queue, InsertManyBack) {
   EXPECT_EQ(our_queue_int.front(), 1);
   EXPECT_EQ(our_queue_int.back(), 3);
 }
+
+TEST(Queue, TakesTheUnderlyingList) {
+  s21::queue<int, s21::pooled_list<int>> our_queue = {1, 2};
+  our_queue.push(3);
+  our_queue.pop();
+  EXPECT_EQ(our_queue.front(), 2);
+  EXPECT_EQ(our_queue.back(), 3);
+  EXPECT_EQ(our_queue.size(), 2U);
+}
+
+TEST(Queue, PushPopChurn) {
+  s21::queue<int> our_queue;
+  std::queue<int> std_queue;
+  for (int i = 0; i < 100000; ++i) {
+    our_queue.push(i);
+    std_queue.push(i);
+    if (i % 3 == 0) {
+      our_queue.pop();
+      std_queue.pop();
+    }
+  }
+  EXPECT_EQ(our_queue.size(), std_queue.size());
+  while (!std_queue.empty()) {
+    ASSERT_EQ(our_queue.front(), std_queue.front());
+    our_queue.pop();
+    std_queue.pop();
+  }
+  EXPECT_TRUE(our_queue.empty());
+}
+
+TEST(Queue, EmplaceAndMove) {
+  s21::queue<std::string> our_queue;
+  std::string payload(100, 'x');
+  const char *data = payload.data();
+  our_queue.push(std::move(payload));
+  our_queue.emplace(3, 'y');
+  our_queue.insert_many_back(std::string("a"), std::string("b"));
+  EXPECT_EQ(our_queue.front().data(), data);
+  EXPECT_EQ(our_queue.size(), 4U);
+  our_queue.pop();
+  EXPECT_EQ(our_queue.front(), "yyy");
+  EXPECT_EQ(our_queue.back(), "b");
+}
+
+TEST(Queue, MoveOnlyElements) {
+  s21::queue<std::unique_ptr<int>> our_queue;
+  our_queue.push(std::make_unique<int>(1));
+  our_queue.emplace(new int(2));
+  EXPECT_EQ(*our_queue.front(), 1);
+  EXPECT_EQ(*our_queue.back(), 2);
+}
+
@@ -0,0 +1,795 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_RADIX_MAP_S21_RADIX_MAP_H
+#define CPP2_S21_CONTAINERS_2_SRC_RADIX_MAP_S21_RADIX_MAP_H
+
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// String-keyed map on an adaptive radix tree. A node stores the bytes all
+// keys below it share (path compression) and keeps its children in the
+// smallest layout that fits them: sorted arrays of 4 or 16, a byte index
+// over 48 slots, or a direct table of 256. A key that ends inside the tree
+// keeps its value in that inner node, so keys may be prefixes of each other.
+//
+// Keys are ordered bytewise, as std::string compares them. Dereferencing an
+// iterator rebuilds the key from the path, like s21::map it yields the
+// element by value. Inserting or erasing may reallocate nodes and
+// invalidates iterators.
+template <typename T>
+class radix_map {
+ public:
+  class Iterator;
+
+  using key_type = std::string;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+  using size_type = size_t;
+
+  radix_map();
+  radix_map(std::initializer_list<value_type> const &items);
+  radix_map(const radix_map &m);
+  radix_map(radix_map &&m);
+  ~radix_map();
+
+  radix_map &operator=(const radix_map &m);
+  radix_map &operator=(radix_map &&m);
+
+  mapped_type &at(const key_type &key);
+  const mapped_type &at(const key_type &key) const;
+  mapped_type &operator[](const key_type &key);
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const key_type &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const T &obj);
+  void erase(iterator pos);
+  void swap(radix_map &other);
+  void merge(radix_map &other);
+
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+
+  // All elements whose key starts with prefix, in key order.
+  std::pair<iterator, iterator> prefix_range(const key_type &prefix) const;
+
+  template <class... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+ private:
+  enum Kind : unsigned char { kLeaf, kNode4, kNode16, kNode48, kNode256 };
+
+  struct Node {
+    explicit Node(Kind node_kind)
+        : parent(nullptr), kind(node_kind), edge(0), count(0) {}
+
+    Node *parent;
+    std::string prefix;
+    std::optional<T> value;
+    Kind kind;
+    unsigned char edge;
+    unsigned short count;
+  };
+
+  template <int N>
+  struct SmallNode : Node {
+    SmallNode() : Node(N == 4 ? kNode4 : kNode16) {}
+
+    unsigned char keys[N];
+    Node *children[N];
+  };
+
+  using Node4 = SmallNode<4>;
+  using Node16 = SmallNode<16>;
+
+  struct Node48 : Node {
+    Node48() : Node(kNode48) { std::memset(index, 0, sizeof(index)); }
+
+    unsigned char index[256];
+    Node *children[48];
+  };
+
+  struct Node256 : Node {
+    Node256() : Node(kNode256) {
+      std::memset(children, 0, sizeof(children));
+    }
+
+    Node *children[256];
+  };
+
+ public:
+  class Iterator {
+   public:
+    Iterator() : node_(nullptr) {}
+    explicit Iterator(Node *node) : node_(node) {}
+
+    value_type operator*() const {
+      return value_type(keyOf(node_), *node_->value);
+    }
+
+    Iterator &operator++() {
+      node_ = nextValue(node_);
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator temp = *this;
+      node_ = nextValue(node_);
+      return temp;
+    }
+
+    bool operator==(const Iterator &other) const {
+      return node_ == other.node_;
+    }
+
+    bool operator!=(const Iterator &other) const {
+      return node_ != other.node_;
+    }
+
+   private:
+    friend class radix_map;
+
+    Node *node_;
+  };
+
+ private:
+  static unsigned char byteAt(const key_type &key, size_type pos) {
+    return static_cast<unsigned char>(key[pos]);
+  }
+
+  static Node *makeNode(Kind kind) {
+    switch (kind) {
+      case kNode4:
+        return new Node4;
+      case kNode16:
+        return new Node16;
+      case kNode48:
+        return new Node48;
+      case kNode256:
+        return new Node256;
+      default:
+        return new Node(kLeaf);
+    }
+  }
+
+  // Frees the node itself; its children are left alone.
+  static void destroyNode(Node *node) {
+    switch (node->kind) {
+      case kNode4:
+        delete static_cast<Node4 *>(node);
+        break;
+      case kNode16:
+        delete static_cast<Node16 *>(node);
+        break;
+      case kNode48:
+        delete static_cast<Node48 *>(node);
+        break;
+      case kNode256:
+        delete static_cast<Node256 *>(node);
+        break;
+      default:
+        delete node;
+    }
+  }
+
+  static void destroyTree(Node *node) {
+    forEachChild(node, [](unsigned char, Node *child) { destroyTree(child); });
+    destroyNode(node);
+  }
+
+  static Node *copyTree(const Node *node) {
+    if (node == nullptr) return nullptr;
+    Node *copy = makeNode(node->kind);
+    copy->prefix = node->prefix;
+    copy->value = node->value;
+    copy->edge = node->edge;
+    forEachChild(node, [copy](unsigned char byte, Node *child) {
+      place(copy, byte, copyTree(child));
+    });
+    return copy;
+  }
+
+  template <int N, typename F>
+  static void forEachSmall(const SmallNode<N> *node, F &f) {
+    for (int i = 0; i < node->count; ++i) f(node->keys[i], node->children[i]);
+  }
+
+  // Calls f(byte, child) for every child in ascending byte order.
+  template <typename F>
+  static void forEachChild(const Node *node, F f) {
+    switch (node->kind) {
+      case kNode4:
+        forEachSmall(static_cast<const Node4 *>(node), f);
+        break;
+      case kNode16:
+        forEachSmall(static_cast<const Node16 *>(node), f);
+        break;
+      case kNode48: {
+        auto indexed = static_cast<const Node48 *>(node);
+        for (int byte = 0; byte < 256; ++byte) {
+          if (indexed->index[byte] != 0) {
+            f(byte, indexed->children[indexed->index[byte] - 1]);
+          }
+        }
+        break;
+      }
+      case kNode256: {
+        auto direct = static_cast<const Node256 *>(node);
+        for (int byte = 0; byte < 256; ++byte) {
+          Node *child = direct->children[byte];
+          if (child != nullptr) f(byte, child);
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  template <int N>
+  static Node **findSmall(SmallNode<N> *node, unsigned char byte) {
+    for (int i = 0; i < node->count; ++i) {
+      if (node->keys[i] == byte) return &node->children[i];
+    }
+    return nullptr;
+  }
+
+  // The slot holding the child under byte, or nullptr.
+  static Node **findChild(Node *node, unsigned char byte) {
+    switch (node->kind) {
+      case kNode4:
+        return findSmall(static_cast<Node4 *>(node), byte);
+      case kNode16:
+        return findSmall(static_cast<Node16 *>(node), byte);
+      case kNode48: {
+        auto indexed = static_cast<Node48 *>(node);
+        unsigned char slot = indexed->index[byte];
+        return slot != 0 ? &indexed->children[slot - 1] : nullptr;
+      }
+      case kNode256: {
+        auto direct = static_cast<Node256 *>(node);
+        return direct->children[byte] != nullptr ? &direct->children[byte]
+                                                 : nullptr;
+      }
+      default:
+        return nullptr;
+    }
+  }
+
+  template <int N>
+  static Node *smallAfter(const SmallNode<N> *node, int after) {
+    for (int i = 0; i < node->count; ++i) {
+      if (node->keys[i] > after) return node->children[i];
+    }
+    return nullptr;
+  }
+
+  // The first child whose byte is greater than after; after == -1 gives the
+  // first child.
+  static Node *childAfter(const Node *node, int after) {
+    switch (node->kind) {
+      case kNode4:
+        return smallAfter(static_cast<const Node4 *>(node), after);
+      case kNode16:
+        return smallAfter(static_cast<const Node16 *>(node), after);
+      case kNode48: {
+        auto indexed = static_cast<const Node48 *>(node);
+        for (int byte = after + 1; byte < 256; ++byte) {
+          if (indexed->index[byte] != 0) {
+            return indexed->children[indexed->index[byte] - 1];
+          }
+        }
+        return nullptr;
+      }
+      case kNode256: {
+        auto direct = static_cast<const Node256 *>(node);
+        for (int byte = after + 1; byte < 256; ++byte) {
+          Node *child = direct->children[byte];
+          if (child != nullptr) return child;
+        }
+        return nullptr;
+      }
+      default:
+        return nullptr;
+    }
+  }
+
+  template <int N>
+  static void placeSmall(SmallNode<N> *node, unsigned char byte, Node *child) {
+    int i = node->count;
+    for (; i > 0 && node->keys[i - 1] > byte; --i) {
+      node->keys[i] = node->keys[i - 1];
+      node->children[i] = node->children[i - 1];
+    }
+    node->keys[i] = byte;
+    node->children[i] = child;
+  }
+
+  // Adds a child to a node known to have room for it.
+  static void place(Node *node, unsigned char byte, Node *child) {
+    switch (node->kind) {
+      case kNode4:
+        placeSmall(static_cast<Node4 *>(node), byte, child);
+        break;
+      case kNode16:
+        placeSmall(static_cast<Node16 *>(node), byte, child);
+        break;
+      case kNode48: {
+        auto indexed = static_cast<Node48 *>(node);
+        indexed->children[node->count] = child;
+        indexed->index[byte] = static_cast<unsigned char>(node->count + 1);
+        break;
+      }
+      case kNode256:
+        static_cast<Node256 *>(node)->children[byte] = child;
+        break;
+      default:
+        return;
+    }
+    adopt(node, byte, child);
+  }
+
+  static void adopt(Node *node, unsigned char byte, Node *child) {
+    child->parent = node;
+    child->edge = byte;
+    ++node->count;
+  }
+
+  template <int N>
+  static void removeSmall(SmallNode<N> *node, unsigned char byte) {
+    int i = 0;
+    while (node->keys[i] != byte) ++i;
+    for (; i + 1 < node->count; ++i) {
+      node->keys[i] = node->keys[i + 1];
+      node->children[i] = node->children[i + 1];
+    }
+  }
+
+  static Kind kindFor(Kind kind, unsigned short count) {
+    if (kind == kNode256 && count < 37) return kNode48;
+    if (kind == kNode48 && count < 13) return kNode16;
+    if (kind == kNode16 && count < 4) return kNode4;
+    if (kind == kNode4 && count == 0) return kLeaf;
+    return kind;
+  }
+
+  static bool isFull(const Node *node) {
+    switch (node->kind) {
+      case kLeaf:
+        return true;
+      case kNode4:
+        return node->count == 4;
+      case kNode16:
+        return node->count == 16;
+      case kNode48:
+        return node->count == 48;
+      default:
+        return false;
+    }
+  }
+
+  Node **slotOf(Node *node) {
+    return node->parent != nullptr ? findChild(node->parent, node->edge)
+                                   : &root_;
+  }
+
+  // Moves node's contents into a fresh node of another kind that takes its
+  // place in the tree.
+  Node *resize(Node *node, Kind kind) {
+    Node *other = makeNode(kind);
+    other->parent = node->parent;
+    other->edge = node->edge;
+    other->prefix = std::move(node->prefix);
+    other->value = std::move(node->value);
+    forEachChild(node, [other](unsigned char byte, Node *child) {
+      place(other, byte, child);
+    });
+    *slotOf(node) = other;
+    destroyNode(node);
+    return other;
+  }
+
+  void addChild(Node *node, unsigned char byte, Node *child) {
+    if (isFull(node)) {
+      Kind bigger = static_cast<Kind>(node->kind + 1);
+      node = resize(node, bigger);
+    }
+    place(node, byte, child);
+  }
+
+  Node *removeChild(Node *node, unsigned char byte) {
+    switch (node->kind) {
+      case kNode4:
+        removeSmall(static_cast<Node4 *>(node), byte);
+        break;
+      case kNode16:
+        removeSmall(static_cast<Node16 *>(node), byte);
+        break;
+      case kNode48: {
+        auto indexed = static_cast<Node48 *>(node);
+        int slot = indexed->index[byte] - 1;
+        int last = node->count - 1;
+        indexed->index[byte] = 0;
+        if (slot != last) {
+          indexed->children[slot] = indexed->children[last];
+          indexed->index[indexed->children[slot]->edge] =
+              static_cast<unsigned char>(slot + 1);
+        }
+        break;
+      }
+      case kNode256:
+        static_cast<Node256 *>(node)->children[byte] = nullptr;
+        break;
+      default:
+        return node;
+    }
+    --node->count;
+    Kind smaller = kindFor(node->kind, node->count);
+    return smaller != node->kind ? resize(node, smaller) : node;
+  }
+
+  // Folds a valueless node with a single child into that child.
+  void collapse(Node *node) {
+    Node *child = childAfter(node, -1);
+    std::string prefix = std::move(node->prefix);
+    prefix.push_back(static_cast<char>(child->edge));
+    prefix += child->prefix;
+    child->prefix = std::move(prefix);
+    *slotOf(node) = child;
+    child->parent = node->parent;
+    child->edge = node->edge;
+    destroyNode(node);
+  }
+
+  // Gives the bytes of node's prefix and the key tail a new parent, leaving
+  // the first match bytes in the new node.
+  Node *split(Node *node, size_type match) {
+    Node4 *upper = new Node4;
+    upper->parent = node->parent;
+    upper->edge = node->edge;
+    upper->prefix.assign(node->prefix, 0, match);
+    *slotOf(node) = upper;
+    unsigned char byte = static_cast<unsigned char>(node->prefix[match]);
+    node->prefix.erase(0, match + 1);
+    placeSmall(upper, byte, node);
+    adopt(upper, byte, node);
+    return upper;
+  }
+
+  Node *attachLeaf(Node *node, const key_type &key, size_type depth) {
+    Node *leaf = makeNode(kLeaf);
+    leaf->prefix.assign(key, depth + 1, key_type::npos);
+    addChild(node, byteAt(key, depth), leaf);
+    return leaf;
+  }
+
+  // The node where key ends, created along with any missing path.
+  Node *nodeFor(const key_type &key) {
+    if (root_ == nullptr) root_ = makeNode(kLeaf);
+    Node *node = root_;
+    size_type depth = 0;
+    while (true) {
+      const std::string &prefix = node->prefix;
+      size_type match = 0;
+      while (match < prefix.size() && depth + match < key.size() &&
+             prefix[match] == key[depth + match]) {
+        ++match;
+      }
+      if (match < prefix.size()) {
+        node = split(node, match);
+        depth += match;
+        return depth == key.size() ? node : attachLeaf(node, key, depth);
+      }
+      depth += match;
+      if (depth == key.size()) return node;
+      Node **slot = findChild(node, byteAt(key, depth));
+      if (slot == nullptr) return attachLeaf(node, key, depth);
+      node = *slot;
+      ++depth;
+    }
+  }
+
+  Node *findNode(const key_type &key) const {
+    Node *node = root_;
+    size_type depth = 0;
+    while (node != nullptr) {
+      const std::string &prefix = node->prefix;
+      if (key.size() - depth < prefix.size() ||
+          key.compare(depth, prefix.size(), prefix) != 0) {
+        return nullptr;
+      }
+      depth += prefix.size();
+      if (depth == key.size()) return node->value ? node : nullptr;
+      Node **slot = findChild(node, byteAt(key, depth));
+      if (slot == nullptr) return nullptr;
+      node = *slot;
+      ++depth;
+    }
+    return nullptr;
+  }
+
+  // Builds node's value from args; node must come straight from nodeFor. If
+  // T's constructor throws, the path nodeFor made for it is taken out again.
+  template <class... Args>
+  void fill(Node *node, Args &&...args) {
+    try {
+      node->value.emplace(std::forward<Args>(args)...);
+    } catch (...) {
+      prune(node);
+      throw;
+    }
+    ++size_;
+  }
+
+  void eraseNode(Node *node) {
+    node->value.reset();
+    --size_;
+    prune(node);
+  }
+
+  // Unlinks the valueless node, or folds it into its only child.
+  void prune(Node *node) {
+    if (node == root_) return;
+    if (node->count == 0) {
+      Node *parent = node->parent;
+      unsigned char byte = node->edge;
+      destroyNode(node);
+      parent = removeChild(parent, byte);
+      if (parent != root_ && !parent->value && parent->count == 1) {
+        collapse(parent);
+      }
+    } else if (node->count == 1) {
+      collapse(node);
+    }
+  }
+
+  // The first node holding a value in node's subtree, in key order.
+  static Node *firstValue(Node *node) {
+    while (node != nullptr && !node->value) node = childAfter(node, -1);
+    return node;
+  }
+
+  // The first node holding a value after node's whole subtree.
+  static Node *afterSubtree(Node *node) {
+    for (; node->parent != nullptr; node = node->parent) {
+      Node *sibling = childAfter(node->parent, node->edge);
+      if (sibling != nullptr) return firstValue(sibling);
+    }
+    return nullptr;
+  }
+
+  static Node *nextValue(Node *node) {
+    Node *child = childAfter(node, -1);
+    return child != nullptr ? firstValue(child) : afterSubtree(node);
+  }
+
+  static key_type keyOf(const Node *node) {
+    size_type length = 0;
+    for (const Node *n = node; n->parent != nullptr; n = n->parent) {
+      length += n->prefix.size() + 1;
+    }
+    key_type key(length, '\0');
+    for (const Node *n = node; n->parent != nullptr; n = n->parent) {
+      length -= n->prefix.size();
+      n->prefix.copy(&key[length], n->prefix.size());
+      key[--length] = static_cast<char>(n->edge);
+    }
+    return key;
+  }
+
+  Node *root_;
+  size_type size_;
+};
+
+template <typename T>
+radix_map<T>::radix_map() : root_(nullptr), size_(0) {}
+
+template <typename T>
+radix_map<T>::radix_map(std::initializer_list<value_type> const &items)
+    : radix_map() {
+  for (const auto &item : items) insert(item);
+}
+
+template <typename T>
+radix_map<T>::radix_map(const radix_map &m)
+    : root_(copyTree(m.root_)), size_(m.size_) {}
+
+template <typename T>
+radix_map<T>::radix_map(radix_map &&m) : root_(m.root_), size_(m.size_) {
+  m.root_ = nullptr;
+  m.size_ = 0;
+}
+
+template <typename T>
+radix_map<T>::~radix_map() {
+  clear();
+}
+
+template <typename T>
+radix_map<T> &radix_map<T>::operator=(const radix_map &m) {
+  if (this != &m) {
+    radix_map temp(m);
+    swap(temp);
+  }
+  return *this;
+}
+
+template <typename T>
+radix_map<T> &radix_map<T>::operator=(radix_map &&m) {
+  if (this != &m) {
+    clear();
+    swap(m);
+  }
+  return *this;
+}
+
+template <typename T>
+typename radix_map<T>::mapped_type &radix_map<T>::at(const key_type &key) {
+  Node *node = findNode(key);
+  if (node == nullptr) {
+    throw std::out_of_range("Out of range. Index exceeds container bounds");
+  }
+  return *node->value;
+}
+
+template <typename T>
+const typename radix_map<T>::mapped_type &radix_map<T>::at(
+    const key_type &key) const {
+  Node *node = findNode(key);
+  if (node == nullptr) {
+    throw std::out_of_range("Out of range. Index exceeds container bounds");
+  }
+  return *node->value;
+}
+
+template <typename T>
+typename radix_map<T>::mapped_type &radix_map<T>::operator[](
+    const key_type &key) {
+  Node *node = nodeFor(key);
+  if (!node->value) fill(node);
+  return *node->value;
+}
+
+template <typename T>
+typename radix_map<T>::iterator radix_map<T>::begin() const {
+  return iterator(firstValue(root_));
+}
+
+template <typename T>
+typename radix_map<T>::iterator radix_map<T>::end() const {
+  return iterator();
+}
+
+template <typename T>
+bool radix_map<T>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T>
+typename radix_map<T>::size_type radix_map<T>::size() const {
+  return size_;
+}
+
+template <typename T>
+typename radix_map<T>::size_type radix_map<T>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(Node);
+}
+
+template <typename T>
+void radix_map<T>::clear() {
+  if (root_ != nullptr) destroyTree(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <typename T>
+std::pair<typename radix_map<T>::iterator, bool> radix_map<T>::insert(
+    const value_type &value) {
+  return insert(value.first, value.second);
+}
+
+template <typename T>
+std::pair<typename radix_map<T>::iterator, bool> radix_map<T>::insert(
+    const key_type &key, const T &obj) {
+  Node *node = nodeFor(key);
+  if (node->value) return {iterator(node), false};
+  fill(node, obj);
+  return {iterator(node), true};
+}
+
+template <typename T>
+std::pair<typename radix_map<T>::iterator, bool>
+radix_map<T>::insert_or_assign(const key_type &key, const T &obj) {
+  Node *node = nodeFor(key);
+  if (node->value) {
+    *node->value = obj;
+    return {iterator(node), false};
+  }
+  fill(node, obj);
+  return {iterator(node), true};
+}
+
+template <typename T>
+void radix_map<T>::erase(iterator pos) {
+  if (pos.node_ != nullptr) eraseNode(pos.node_);
+}
+
+template <typename T>
+void radix_map<T>::swap(radix_map &other) {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+}
+
+template <typename T>
+void radix_map<T>::merge(radix_map &other) {
+  for (auto it = other.begin(); it != other.end(); ++it) {
+    Node *node = nodeFor(keyOf(it.node_));
+    if (!node->value) fill(node, *it.node_->value);
+  }
+  other.clear();
+}
+
+template <typename T>
+typename radix_map<T>::iterator radix_map<T>::find(const key_type &key) const {
+  return iterator(findNode(key));
+}
+
+template <typename T>
+bool radix_map<T>::contains(const key_type &key) const {
+  return findNode(key) != nullptr;
+}
+
+template <typename T>
+std::pair<typename radix_map<T>::iterator, typename radix_map<T>::iterator>
+radix_map<T>::prefix_range(const key_type &prefix) const {
+  Node *node = root_;
+  size_type depth = 0;
+  while (node != nullptr) {
+    size_type rest = prefix.size() - depth;
+    size_type common = std::min(rest, node->prefix.size());
+    if (prefix.compare(depth, common, node->prefix, 0, common) != 0) break;
+    if (rest <= node->prefix.size()) {
+      return {iterator(firstValue(node)), iterator(afterSubtree(node))};
+    }
+    depth += node->prefix.size();
+    Node **slot = findChild(node, byteAt(prefix, depth));
+    if (slot == nullptr) break;
+    node = *slot;
+    ++depth;
+  }
+  return {end(), end()};
+}
+
+template <typename T>
+template <class... Args>
+s21::vector<std::pair<typename radix_map<T>::iterator, bool>>
+radix_map<T>::insert_many(Args &&...args) {
+  s21::vector<std::pair<iterator, bool>> vec;
+  for (const auto &arg : {args...}) {
+    vec.push_back(insert(arg));
+  }
+  return vec;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_RADIX_MAP_S21_RADIX_MAP_H
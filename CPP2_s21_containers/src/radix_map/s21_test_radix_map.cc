@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "s21_radix_map.h"
+
+namespace {
+
+template <typename T>
+void expectSameContents(const s21::radix_map<T> &my_map,
+                        const std::map<std::string, T> &map) {
+  EXPECT_EQ(my_map.size(), map.size());
+  auto it = map.begin();
+  for (auto my_it = my_map.begin(); my_it != my_map.end(); ++my_it, ++it) {
+    ASSERT_TRUE(it != map.end());
+    EXPECT_EQ((*my_it).first, it->first);
+    EXPECT_EQ((*my_it).second, it->second);
+  }
+  EXPECT_TRUE(it == map.end());
+}
+
+// Refuses to copy negative values, and to default-construct while armed.
+struct Picky {
+  static inline bool armed = false;
+
+  Picky() : value(0) {
+    if (armed) throw std::runtime_error("default");
+  }
+  explicit Picky(int v) : value(v) {}
+  Picky(const Picky &other) : value(other.value) {
+    if (value < 0) throw std::runtime_error("copy");
+  }
+  Picky &operator=(const Picky &other) = default;
+  bool operator==(const Picky &other) const { return value == other.value; }
+
+  int value;
+};
+
+}  // namespace
+
+TEST(radix_map, ConstructorDefault) {
+  s21::radix_map<int> my_map;
+  EXPECT_TRUE(my_map.empty());
+  EXPECT_EQ(my_map.size(), 0U);
+  EXPECT_TRUE(my_map.begin() == my_map.end());
+  EXPECT_FALSE(my_map.contains(""));
+}
+
+TEST(radix_map, ConstructorInitializer) {
+  s21::radix_map<int> my_map = {{"romane", 1}, {"romanus", 2}, {"rom", 3},
+                                {"rubens", 4}, {"ruber", 5},   {"", 6}};
+  std::map<std::string, int> map = {{"romane", 1}, {"romanus", 2}, {"rom", 3},
+                                    {"rubens", 4}, {"ruber", 5},   {"", 6}};
+  expectSameContents(my_map, map);
+}
+
+TEST(radix_map, InsertAndAt) {
+  s21::radix_map<std::string> my_map;
+  EXPECT_TRUE(my_map.insert("test", "one").second);
+  EXPECT_TRUE(my_map.insert("team", "two").second);
+  EXPECT_TRUE(my_map.insert("te", "three").second);
+  auto pr = my_map.insert("test", "other");
+  EXPECT_FALSE(pr.second);
+  EXPECT_EQ((*pr.first).second, "one");
+  EXPECT_EQ(my_map.at("te"), "three");
+  EXPECT_THROW(my_map.at("t"), std::out_of_range);
+  EXPECT_THROW(my_map.at("tests"), std::out_of_range);
+  my_map["t"] = "four";
+  EXPECT_EQ(my_map.at("t"), "four");
+  EXPECT_FALSE(my_map.insert_or_assign("t", "five").second);
+  EXPECT_EQ(my_map.at("t"), "five");
+  EXPECT_EQ(my_map.size(), 4U);
+}
+
+TEST(radix_map, BytesAboveAsciiSortLikeStdString) {
+  s21::radix_map<int> my_map;
+  std::map<std::string, int> map;
+  for (int byte = 0; byte < 256; byte += 3) {
+    std::string key = "k" + std::string(1, static_cast<char>(byte));
+    my_map.insert(key, byte);
+    map[key] = byte;
+  }
+  expectSameContents(my_map, map);
+}
+
+TEST(radix_map, GrowsAndShrinksNodes) {
+  s21::radix_map<int> my_map;
+  std::map<std::string, int> map;
+  for (int byte = 0; byte < 256; ++byte) {
+    std::string key = "/metrics/" + std::string(1, static_cast<char>(byte));
+    my_map.insert(key, byte);
+    map[key] = byte;
+  }
+  expectSameContents(my_map, map);
+  for (int byte = 0; byte < 256; ++byte) {
+    if (byte % 17 == 0) continue;
+    std::string key = "/metrics/" + std::string(1, static_cast<char>(byte));
+    my_map.erase(my_map.find(key));
+    map.erase(key);
+  }
+  expectSameContents(my_map, map);
+}
+
+TEST(radix_map, EraseCollapsesPaths) {
+  s21::radix_map<int> my_map = {{"abc", 1}, {"abd", 2}, {"ab", 3}};
+  my_map.erase(my_map.find("ab"));
+  my_map.erase(my_map.find("abd"));
+  EXPECT_FALSE(my_map.contains("ab"));
+  EXPECT_FALSE(my_map.contains("abd"));
+  EXPECT_EQ(my_map.at("abc"), 1);
+  my_map.insert("abx", 4);
+  my_map.erase(my_map.find("abc"));
+  EXPECT_EQ(my_map.at("abx"), 4);
+  my_map.erase(my_map.find("abx"));
+  EXPECT_TRUE(my_map.empty());
+  EXPECT_TRUE(my_map.begin() == my_map.end());
+}
+
+TEST(radix_map, ThrowingValueLeavesNoEmptyPath) {
+  std::map<std::string, Picky> map = {
+      {"abc", Picky(1)}, {"abd", Picky(2)}, {"ab", Picky(3)}};
+  s21::radix_map<Picky> my_map;
+  for (const auto &[key, value] : map) my_map.insert(key, value);
+  // A new leaf, a leaf below a leaf, a split prefix and a split that ends
+  // the key: every shape of path that nodeFor can create.
+  for (const char *key : {"abz", "abcd", "abcx", "a", "q"}) {
+    EXPECT_THROW(my_map.insert(key, Picky(-1)), std::runtime_error);
+    EXPECT_THROW(my_map.insert_or_assign(key, Picky(-1)), std::runtime_error);
+    Picky::armed = true;
+    EXPECT_THROW(my_map[key], std::runtime_error);
+    Picky::armed = false;
+    EXPECT_FALSE(my_map.contains(key));
+    expectSameContents(my_map, map);
+  }
+  my_map["a"] = Picky(7);
+  map["a"] = Picky(7);
+  expectSameContents(my_map, map);
+  my_map.erase(my_map.find("ab"));
+  map.erase("ab");
+  expectSameContents(my_map, map);
+
+  s21::radix_map<Picky> empty;
+  EXPECT_THROW(empty.insert("k", Picky(-1)), std::runtime_error);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(radix_map, MatchesStdMapUnderChurn) {
+  s21::radix_map<int> my_map;
+  std::map<std::string, int> map;
+  unsigned state = 99;
+  for (int i = 0; i < 20000; ++i) {
+    state = state * 1103515245U + 12345U;
+    std::string key = "/api/v" + std::to_string((state >> 8) % 3) + "/" +
+                      std::to_string((state >> 12) % 300);
+    if ((state >> 4) % 3 == 0 && my_map.contains(key)) {
+      my_map.erase(my_map.find(key));
+      map.erase(key);
+    } else {
+      my_map.insert_or_assign(key, i);
+      map[key] = i;
+    }
+    ASSERT_EQ(my_map.size(), map.size());
+  }
+  expectSameContents(my_map, map);
+}
+
+TEST(radix_map, PrefixRange) {
+  s21::radix_map<int> my_map = {{"cpu.user", 1},  {"cpu.system", 2},
+                                {"cpu", 3},       {"disk.read", 4},
+                                {"cpuset.mem", 5}};
+  auto range = my_map.prefix_range("cpu.");
+  std::string keys;
+  for (auto it = range.first; it != range.second; ++it) {
+    keys += (*it).first + ";";
+  }
+  EXPECT_EQ(keys, "cpu.system;cpu.user;");
+
+  range = my_map.prefix_range("cp");
+  int count = 0;
+  for (auto it = range.first; it != range.second; ++it) ++count;
+  EXPECT_EQ(count, 4);
+
+  range = my_map.prefix_range("disk.r");
+  EXPECT_EQ((*range.first).first, "disk.read");
+  EXPECT_TRUE(range.second == my_map.end());
+
+  range = my_map.prefix_range("mem");
+  EXPECT_TRUE(range.first == range.second);
+  range = my_map.prefix_range("");
+  count = 0;
+  for (auto it = range.first; it != range.second; ++it) ++count;
+  EXPECT_EQ(count, 5);
+}
+
+TEST(radix_map, CopyMoveSwapMerge) {
+  s21::radix_map<int> my_map = {{"one", 1}, {"two", 2}};
+  s21::radix_map<int> copy(my_map);
+  my_map.insert("three", 3);
+  EXPECT_EQ(copy.size(), 2U);
+  EXPECT_FALSE(copy.contains("three"));
+
+  s21::radix_map<int> moved(std::move(my_map));
+  EXPECT_TRUE(my_map.empty());
+  EXPECT_EQ(moved.size(), 3U);
+
+  copy.swap(moved);
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_EQ(moved.size(), 2U);
+
+  s21::radix_map<int> other = {{"four", 4}, {"one", 10}};
+  copy.merge(other);
+  EXPECT_EQ(copy.size(), 4U);
+  EXPECT_EQ(copy.at("one"), 1);
+  EXPECT_TRUE(other.empty());
+
+  moved = copy;
+  EXPECT_EQ(moved.size(), 4U);
+  EXPECT_EQ(moved.at("four"), 4);
+}
+
+TEST(radix_map, InsertMany) {
+  s21::radix_map<int> my_map;
+  auto res = my_map.insert_many(std::make_pair(std::string("a"), 1),
+                                std::make_pair(std::string("b"), 2),
+                                std::make_pair(std::string("a"), 3));
+  EXPECT_EQ(res.size(), 3U);
+  EXPECT_TRUE(res[0].second);
+  EXPECT_TRUE(res[1].second);
+  EXPECT_FALSE(res[2].second);
+  EXPECT_EQ(my_map.at("a"), 1);
+}
@@ -1,7 +1,22 @@
 #ifndef CPP_2_S21_CONTAINERS_2_SRC_S21_CONTAINERSPLUS_H_
 #define CPP_2_S21_CONTAINERS_2_SRC_S21_CONTAINERSPLUS_H_
 
+#include "allocator/s21_pool_allocator.h"
 #include "array/s21_array.h"
+#include "concurrent_skiplist_map/s21_concurrent_skiplist_map.h"
+#include "indexed_list/s21_indexed_list.h"
+#include "intrusive_list/s21_intrusive_list.h"
+#include "mmap_vector/s21_mmap_vector.h"
 #include "multiset/s21_multiset.h"
+#include "pmr/s21_pmr.h"
+#include "radix_map/s21_radix_map.h"
+#include "simd/s21_simd.h"
+#include "small_vector/s21_small_vector.h"
+#include "soa_vector/s21_soa_vector.h"
+#include "static_map/s21_static_map.h"
+#include "static_set/s21_static_set.h"
+#include "thread_pool/s21_parallel.h"
+#include "thread_pool/s21_thread_pool.h"
+#include "unrolled_list/s21_unrolled_list.h"
 
 #endif  // CPP_2_S21_CONTAINERS_2_SRC_S21_CONTAINERSPLUS_H_
\ No newline at end of file
@@ -11,31 +11,42 @@
 
 namespace s21 {
 
-template <typename T>
-class set : public AVLTree<T, T> {
+template <typename T, typename Lookup = plain_lookup,
+          typename Allocator = std::allocator<T>>
+class set : public AVLTree<T, T, Lookup, Allocator> {
  public:
+  using tree_type = AVLTree<T, T, Lookup, Allocator>;
+
   using key_type = T;
   using value_type = T;
   using reference = value_type &;
-  using iterator = typename AVLTree<T, T>::Iterator;
-  using const_iterator = typename AVLTree<T, T>::ConstIterator;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   set();
-  set(std::initializer_list<value_type> const &items);
+  explicit set(const Allocator &alloc);
+  set(std::initializer_list<value_type> const &items,
+      const Allocator &alloc = Allocator());
   set(const set &s);
   set(set &&s);
   ~set() = default;
 
-  set<T> &operator=(const set &s);
-  set<T> &operator=(set &&s);
+  set<T, Lookup, Allocator> &operator=(const set &s);
+  set<T, Lookup, Allocator> &operator=(set &&s) noexcept(
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value ||
+      std::allocator_traits<Allocator>::is_always_equal::value);
 
   iterator begin();
+  const_iterator begin() const;
   iterator end();
+  const_iterator end() const;
 
-  bool empty();
-  size_type size();
-  size_type max_size();
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
 
   void clear();
   std::pair<iterator, bool> insert(const value_type &value);
@@ -44,133 +55,165 @@ class set : public AVLTree<T, T> {
   void merge(set &other);
 
   iterator find(const T &key);
-  bool contains(const T &key);
+  const_iterator find(const T &key) const;
+  bool contains(const T &key) const;
 
   template <class... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
 };
 
-template <typename T>
-set<T>::set() : AVLTree<T, T>() {}
+template <typename T, typename Lookup, typename Allocator>
+set<T, Lookup, Allocator>::set() : tree_type() {}
 
-template <typename T>
-set<T>::set(const std::initializer_list<value_type> &items) {
+template <typename T, typename Lookup, typename Allocator>
+set<T, Lookup, Allocator>::set(const Allocator &alloc) : tree_type(alloc) {}
+
+template <typename T, typename Lookup, typename Allocator>
+set<T, Lookup, Allocator>::set(const std::initializer_list<value_type> &items,
+                    const Allocator &alloc)
+    : tree_type(alloc) {
   for (auto &it : items) {
-    AVLTree<T, T>::insert(it, it);
+    tree_type::insert(it, it);
   }
 }
 
-template <typename T>
-set<T>::set(const set &s) : AVLTree<T, T>(s) {}
+template <typename T, typename Lookup, typename Allocator>
+set<T, Lookup, Allocator>::set(const set &s) : tree_type(s) {}
 
-template <typename T>
-set<T>::set(set &&s) : AVLTree<T, T>(std::move(s)) {}
+template <typename T, typename Lookup, typename Allocator>
+set<T, Lookup, Allocator>::set(set &&s) : tree_type(std::move(s)) {}
 
-template <typename T>
-set<T> &set<T>::operator=(const set<T> &s) {
+template <typename T, typename Lookup, typename Allocator>
+set<T, Lookup, Allocator> &set<T, Lookup, Allocator>::operator=(
+    const set &s) {
   if (this != &s) {
-    AVLTree<T, T>::operator=(s);
+    tree_type::operator=(s);
   }
   return *this;
 }
 
-template <typename T>
-set<T> &set<T>::operator=(set<T> &&s) {
+template <typename T, typename Lookup, typename Allocator>
+set<T, Lookup, Allocator> &set<T, Lookup, Allocator>::operator=(
+    set &&s) noexcept(
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
   if (this != &s) {
-    AVLTree<T, T>::operator=(s);
+    tree_type::operator=(std::move(s));
   }
   return *this;
 }
 
-template <typename T>
-typename set<T>::iterator set<T>::begin() {
-  return iterator(AVLTree<T, T>::getMin(AVLTree<T, T>::root_));
+template <typename T, typename Lookup, typename Allocator>
+typename set<T, Lookup, Allocator>::iterator
+set<T, Lookup, Allocator>::begin() {
+  return iterator(tree_type::getMin(tree_type::root_));
 }
 
-template <typename T>
-typename set<T>::iterator set<T>::end() {
-  if (AVLTree<T, T>::root_ == nullptr) return begin();
-  typename AVLTree<T, T>::Node *last_node =
-      AVLTree<T, T>::getMax(AVLTree<T, T>::root_);
+template <typename T, typename Lookup, typename Allocator>
+typename set<T, Lookup, Allocator>::const_iterator
+set<T, Lookup, Allocator>::begin() const {
+  return const_iterator(tree_type::getMin(tree_type::root_));
+}
+
+template <typename T, typename Lookup, typename Allocator>
+typename set<T, Lookup, Allocator>::iterator set<T, Lookup, Allocator>::end() {
+  if (tree_type::root_ == nullptr) return begin();
+  typename tree_type::Node *last_node = tree_type::getMax(tree_type::root_);
   iterator fake(nullptr, last_node);
   return fake;
 }
 
-template <typename T>
-bool set<T>::empty() {
-  return begin() == nullptr;
+template <typename T, typename Lookup, typename Allocator>
+typename set<T, Lookup, Allocator>::const_iterator
+set<T, Lookup, Allocator>::end() const {
+  if (tree_type::root_ == nullptr) return begin();
+  return const_iterator(nullptr, tree_type::getMax(tree_type::root_));
 }
 
-template <typename T>
-size_t set<T>::size() {
-  return AVLTree<T, T>::recursiveSize(AVLTree<T, T>::root_);
+template <typename T, typename Lookup, typename Allocator>
+bool set<T, Lookup, Allocator>::empty() const {
+  return tree_type::root_ == nullptr;
 }
 
-template <typename T>
-size_t set<T>::max_size() {
+template <typename T, typename Lookup, typename Allocator>
+size_t set<T, Lookup, Allocator>::size() const {
+  return tree_type::recursiveSize(tree_type::root_);
+}
+
+template <typename T, typename Lookup, typename Allocator>
+size_t set<T, Lookup, Allocator>::max_size() const {
   return std::numeric_limits<size_type>::max() /
-         sizeof(typename AVLTree<T, T>::Node);
+         sizeof(typename tree_type::Node);
 }
 
-template <typename T>
-void set<T>::clear() {
-  if (AVLTree<T, T>::root_ != nullptr)
-    AVLTree<T, T>::recursiveClear(AVLTree<T, T>::root_);
-  AVLTree<T, T>::root_ = nullptr;
+template <typename T, typename Lookup, typename Allocator>
+void set<T, Lookup, Allocator>::clear() {
+  tree_type::clearTree();
 }
 
-template <typename T>
-std::pair<typename set<T>::iterator, bool> set<T>::insert(const T &value) {
-  AVLTree<T, T>::insert(value, value);
-  std::pair<typename AVLTree<T, T>::Iterator, bool> return_value;
+template <typename T, typename Lookup, typename Allocator>
+std::pair<typename set<T, Lookup, Allocator>::iterator, bool>
+set<T, Lookup, Allocator>::insert(const T &value) {
+  tree_type::insert(value, value);
+  std::pair<typename tree_type::Iterator, bool> return_value;
   return_value =
-      std::pair<iterator, bool>(find(value), AVLTree<T, T>::inserted);
+      std::pair<iterator, bool>(find(value), tree_type::inserted);
   return return_value;
 }
 
-template <typename T>
-void set<T>::erase(iterator pos) {
-  AVLTree<T, T>::root_ =
-      AVLTree<T, T>::recursiveClearNode(AVLTree<T, T>::root_, *pos);
+template <typename T, typename Lookup, typename Allocator>
+void set<T, Lookup, Allocator>::erase(iterator pos) {
+  tree_type::root_ = tree_type::recursiveClearNode(tree_type::root_, *pos);
 }
 
-template <typename T>
-void set<T>::swap(set<T> &other) {
-  std::swap(AVLTree<T, T>::root_, other.root_);
+template <typename T, typename Lookup, typename Allocator>
+void set<T, Lookup, Allocator>::swap(set<T, Lookup, Allocator> &other) {
+  tree_type::swapTree(other);
 }
 
-template <typename T>
-void set<T>::merge(set<T> &other) {
+template <typename T, typename Lookup, typename Allocator>
+void set<T, Lookup, Allocator>::merge(set<T, Lookup, Allocator> &other) {
   for (auto it = other.begin(); it != other.end(); it++) {
     insert(*it);
   }
   other.clear();
 }
 
-template <typename T>
-typename set<T>::iterator set<T>::find(const T &key) {
-  typename AVLTree<T, T>::Node *temp =
-      AVLTree<T, T>::recursiveFind(AVLTree<T, T>::root_, key);
+template <typename T, typename Lookup, typename Allocator>
+typename set<T, Lookup, Allocator>::iterator
+set<T, Lookup, Allocator>::find(const T &key) {
+  typename tree_type::Node *temp = tree_type::findNode(key);
   return iterator(temp);
 }
 
-template <typename T>
-bool set<T>::contains(const T &key) {
-  typename AVLTree<T, T>::Node *temp =
-      AVLTree<T, T>::recursiveFind(AVLTree<T, T>::root_, key);
+template <typename T, typename Lookup, typename Allocator>
+typename set<T, Lookup, Allocator>::const_iterator
+set<T, Lookup, Allocator>::find(const T &key) const {
+  return const_iterator(tree_type::findNode(key));
+}
+
+template <typename T, typename Lookup, typename Allocator>
+bool set<T, Lookup, Allocator>::contains(const T &key) const {
+  typename tree_type::Node *temp = tree_type::findNode(key);
   return temp != nullptr;
 }
 
-template <typename T>
+template <typename T, typename Lookup, typename Allocator>
 template <class... Args>
-s21::vector<std::pair<typename set<T>::iterator, bool>> set<T>::insert_many(
-    Args &&...args) {
-  s21::vector<std::pair<typename set<T>::iterator, bool>> vec;
+s21::vector<std::pair<typename set<T, Lookup, Allocator>::iterator, bool>>
+set<T, Lookup, Allocator>::insert_many(Args &&...args) {
+  s21::vector<std::pair<iterator, bool>> vec;
   for (const auto &arg : {args...}) {
-    vec.push_back(AVLTree<T, T>::insert(arg));
+    vec.push_back(tree_type::insert(arg));
   }
   return vec;
 }
 
+// Serves repeated lookups of hot keys from a cache in front of the tree,
+// for skewed access patterns where a few keys take most of the traffic.
+template <typename T>
+using adaptive_set = set<T, hot_key_cache<>>;
+
 }  // namespace s21
 #endif  // CPP2_S21_CONTAINERS_2_SRC_SET_S21_SET_H
\ No newline at end of file
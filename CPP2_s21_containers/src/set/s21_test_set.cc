@@ -231,3 +231,53 @@ TEST(set, erase_test_1) {
 
   EXPECT_EQ(s21ms.size(), ms.size());
 }
+
+TEST(set, ConstReadApi) {
+  const s21::set<int> my_set = {4, 1, 3, 2};
+  const std::set<int> set = {4, 1, 3, 2};
+  EXPECT_FALSE(my_set.empty());
+  EXPECT_EQ(my_set.size(), set.size());
+  EXPECT_TRUE(my_set.contains(3));
+  EXPECT_FALSE(my_set.contains(5));
+  EXPECT_EQ(*my_set.find(2), 2);
+  EXPECT_TRUE(my_set.find(5) == my_set.end());
+  auto it = set.begin();
+  for (auto my_it = my_set.begin(); my_it != my_set.end(); ++my_it, ++it) {
+    EXPECT_EQ(*my_it, *it);
+  }
+}
+
+TEST(set, IteratorPostfixReturnsPreviousPosition) {
+  s21::set<int> my_set = {1, 2, 3};
+  auto my_it = my_set.begin();
+  auto first = my_it++;
+  auto second = my_it++;
+  EXPECT_EQ(*first, 1);
+  EXPECT_EQ(*second, 2);
+  EXPECT_EQ(*my_it, 3);
+  auto third = my_it--;
+  EXPECT_EQ(*third, 3);
+  EXPECT_EQ(*my_it, 2);
+}
+
+TEST(set, AdaptiveEraseOfInnerNode) {
+  s21::adaptive_set<int> my_set = {4, 2, 6, 1, 3, 5, 7};
+  for (int key = 1; key <= 7; ++key) EXPECT_TRUE(my_set.contains(key));
+  my_set.erase(my_set.find(4));
+  my_set.erase(my_set.find(2));
+  EXPECT_FALSE(my_set.contains(4));
+  EXPECT_FALSE(my_set.contains(2));
+  for (int key : {1, 3, 5, 6, 7}) EXPECT_EQ(*my_set.find(key), key);
+  EXPECT_EQ(my_set.size(), 5U);
+}
+
+TEST(set, AdaptiveCopyAndMove) {
+  s21::adaptive_set<int> my_set = {1, 2, 3};
+  EXPECT_TRUE(my_set.contains(2));
+  s21::adaptive_set<int> copy = my_set;
+  s21::adaptive_set<int> moved(std::move(my_set));
+  EXPECT_FALSE(my_set.contains(2));
+  EXPECT_TRUE(copy.contains(2));
+  EXPECT_TRUE(moved.contains(2));
+  EXPECT_TRUE(moved.find(4) == moved.end());
+}
@@ -0,0 +1,650 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_SIMD_S21_SIMD_H
+#define CPP2_S21_CONTAINERS_2_SRC_SIMD_S21_SIMD_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+
+// Linear scans over contiguous int32_t and float buffers (s21::vector,
+// s21::array, plain pointers) using the widest vector unit the CPU has.
+// Every kernel is compiled for SSE2, AVX2 and AVX-512F regardless of the
+// build flags; the best one is picked once, at first use, from CPUID. Other
+// element types, other compilers and other architectures get the scalar
+// loops, so the functions are safe to call with any T.
+//
+// Results match the std algorithm of the same name, with two exceptions
+// for float: accumulate() adds in lanes, so rounding differs from a left
+// fold, and min_element()/max_element() are unspecified for ranges that
+// hold a NaN. Integer sums wrap instead of overflowing.
+namespace simd {
+
+enum class isa { scalar, sse2, avx2, avx512 };
+
+inline const char *isa_name(isa level) {
+  switch (level) {
+    case isa::sse2:
+      return "sse2";
+    case isa::avx2:
+      return "avx2";
+    case isa::avx512:
+      return "avx512";
+    default:
+      return "scalar";
+  }
+}
+
+// The widest instruction set both this build and the running CPU support.
+// The AVX2 and AVX-512 kernels also count matches with popcnt.
+inline isa detected_isa() {
+#if S21_SIMD_X86
+  static const isa level = [] {
+    __builtin_cpu_init();
+    bool popcnt = __builtin_cpu_supports("popcnt");
+    if (popcnt && __builtin_cpu_supports("avx512f")) return isa::avx512;
+    if (popcnt && __builtin_cpu_supports("avx2")) return isa::avx2;
+    return isa::sse2;
+  }();
+  return level;
+#else
+  return isa::scalar;
+#endif
+}
+
+template <typename T>
+struct kernels {
+  const T *(*find)(const T *, const T *, T);
+  std::size_t (*count)(const T *, const T *, T);
+  const T *(*min_element)(const T *, const T *);
+  const T *(*max_element)(const T *, const T *);
+  T (*accumulate)(const T *, const T *, T);
+};
+
+template <typename T>
+inline constexpr bool is_vectorizable_v =
+    std::is_same_v<T, std::int32_t> || std::is_same_v<T, float>;
+
+namespace scalar {
+
+// Integer sums wrap, as the vector adds do.
+inline std::int32_t plus(std::int32_t a, std::int32_t b) {
+  return static_cast<std::int32_t>(static_cast<std::uint32_t>(a) +
+                                   static_cast<std::uint32_t>(b));
+}
+
+template <typename T>
+T plus(const T &a, const T &b) {
+  return a + b;
+}
+
+template <typename T>
+const T *find(const T *first, const T *last, T value) {
+  return std::find(first, last, value);
+}
+
+template <typename T>
+std::size_t count(const T *first, const T *last, T value) {
+  return std::count(first, last, value);
+}
+
+template <typename T>
+const T *min_element(const T *first, const T *last) {
+  return std::min_element(first, last);
+}
+
+template <typename T>
+const T *max_element(const T *first, const T *last) {
+  return std::max_element(first, last);
+}
+
+template <typename T>
+T accumulate(const T *first, const T *last, T init) {
+  for (; first != last; ++first) init = plus(init, *first);
+  return init;
+}
+
+}  // namespace scalar
+
+#if S21_SIMD_X86
+
+#define S21_SIMD_TARGET(isa) __attribute__((target(isa)))
+
+// Each ISA namespace below provides the same overloaded primitives (load,
+// splat, eqMask, vmin, vmax, vadd and the horizontal reductions) and the
+// same five algorithms written against them. The algorithms are repeated
+// rather than shared because the target attribute has to sit on the
+// function that does the work.
+
+namespace sse2 {
+
+S21_SIMD_TARGET("sse2") inline __m128i load(const std::int32_t *p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+S21_SIMD_TARGET("sse2") inline __m128 load(const float *p) {
+  return _mm_loadu_ps(p);
+}
+S21_SIMD_TARGET("sse2") inline __m128i splat(std::int32_t v) {
+  return _mm_set1_epi32(v);
+}
+S21_SIMD_TARGET("sse2") inline __m128 splat(float v) { return _mm_set1_ps(v); }
+S21_SIMD_TARGET("sse2") inline unsigned eqMask(__m128i a, __m128i b) {
+  return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+}
+S21_SIMD_TARGET("sse2") inline unsigned eqMask(__m128 a, __m128 b) {
+  return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+}
+// SSE2 has no 32-bit integer min/max; select through a compare.
+S21_SIMD_TARGET("sse2") inline __m128i vmin(__m128i a, __m128i b) {
+  __m128i gt = _mm_cmpgt_epi32(a, b);
+  return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+}
+S21_SIMD_TARGET("sse2") inline __m128i vmax(__m128i a, __m128i b) {
+  __m128i gt = _mm_cmpgt_epi32(a, b);
+  return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+}
+S21_SIMD_TARGET("sse2") inline __m128 vmin(__m128 a, __m128 b) {
+  return _mm_min_ps(a, b);
+}
+S21_SIMD_TARGET("sse2") inline __m128 vmax(__m128 a, __m128 b) {
+  return _mm_max_ps(a, b);
+}
+S21_SIMD_TARGET("sse2") inline __m128i vadd(__m128i a, __m128i b) {
+  return _mm_add_epi32(a, b);
+}
+S21_SIMD_TARGET("sse2") inline __m128 vadd(__m128 a, __m128 b) {
+  return _mm_add_ps(a, b);
+}
+S21_SIMD_TARGET("sse2") inline void store(std::int32_t *p, __m128i v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+}
+S21_SIMD_TARGET("sse2") inline void store(float *p, __m128 v) {
+  _mm_storeu_ps(p, v);
+}
+
+// Bits set in a 4-lane mask, looked up in a nibble table: SSE2-only CPUs
+// may lack popcnt.
+inline unsigned bitCount(unsigned mask) {
+  return (0x4332322132212110ULL >> (mask * 4)) & 0xF;
+}
+
+template <typename T>
+using vec_t = decltype(load(static_cast<const T *>(nullptr)));
+
+template <typename T>
+inline constexpr std::ptrdiff_t kLanes = 16 / sizeof(T);
+
+template <typename T>
+S21_SIMD_TARGET("sse2")
+const T *find(const T *first, const T *last, T value) {
+  const vec_t<T> needle = splat(value);
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    unsigned mask = eqMask(load(first), needle);
+    if (mask != 0) return first + __builtin_ctz(mask);
+  }
+  return scalar::find(first, last, value);
+}
+
+template <typename T>
+S21_SIMD_TARGET("sse2")
+std::size_t count(const T *first, const T *last, T value) {
+  const vec_t<T> needle = splat(value);
+  std::size_t n = 0;
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    n += bitCount(eqMask(load(first), needle));
+  }
+  return n + scalar::count(first, last, value);
+}
+
+// Finds the extreme value in lanes, then its first position.
+template <typename T, bool Max>
+S21_SIMD_TARGET("sse2")
+const T *extremeElement(const T *first, const T *last) {
+  if (last - first < kLanes<T>) {
+    return Max ? scalar::max_element(first, last)
+               : scalar::min_element(first, last);
+  }
+  const T *p = first;
+  vec_t<T> best = load(p);
+  for (p += kLanes<T>; last - p >= kLanes<T>; p += kLanes<T>) {
+    best = Max ? vmax(best, load(p)) : vmin(best, load(p));
+  }
+  T lanes[kLanes<T>];
+  store(lanes, best);
+  T value = Max ? *scalar::max_element(lanes, lanes + kLanes<T>)
+                : *scalar::min_element(lanes, lanes + kLanes<T>);
+  for (; p != last; ++p) {
+    if (Max ? value < *p : *p < value) value = *p;
+  }
+  return find(first, last, value);
+}
+
+template <typename T>
+S21_SIMD_TARGET("sse2")
+const T *min_element(const T *first, const T *last) {
+  return extremeElement<T, false>(first, last);
+}
+
+template <typename T>
+S21_SIMD_TARGET("sse2")
+const T *max_element(const T *first, const T *last) {
+  return extremeElement<T, true>(first, last);
+}
+
+template <typename T>
+S21_SIMD_TARGET("sse2")
+T accumulate(const T *first, const T *last, T init) {
+  vec_t<T> sum = splat(T());
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    sum = vadd(sum, load(first));
+  }
+  T lanes[kLanes<T>];
+  store(lanes, sum);
+  init = scalar::accumulate(lanes, lanes + kLanes<T>, init);
+  return scalar::accumulate(first, last, init);
+}
+
+}  // namespace sse2
+
+namespace avx2 {
+
+S21_SIMD_TARGET("avx2,popcnt") inline __m256i load(const std::int32_t *p) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+}
+S21_SIMD_TARGET("avx2,popcnt") inline __m256 load(const float *p) {
+  return _mm256_loadu_ps(p);
+}
+S21_SIMD_TARGET("avx2,popcnt") inline __m256i splat(std::int32_t v) {
+  return _mm256_set1_epi32(v);
+}
+S21_SIMD_TARGET("avx2,popcnt") inline __m256 splat(float v) {
+  return _mm256_set1_ps(v);
+}
+S21_SIMD_TARGET("avx2,popcnt") inline unsigned eqMask(__m256i a, __m256i b) {
+  return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+}
+S21_SIMD_TARGET("avx2,popcnt") inline unsigned eqMask(__m256 a, __m256 b) {
+  return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+}
+S21_SIMD_TARGET("avx2,popcnt") inline __m256i vmin(__m256i a, __m256i b) {
+  return _mm256_min_epi32(a, b);
+}
+S21_SIMD_TARGET("avx2,popcnt") inline __m256i vmax(__m256i a, __m256i b) {
+  return _mm256_max_epi32(a, b);
+}
+S21_SIMD_TARGET("avx2,popcnt") inline __m256 vmin(__m256 a, __m256 b) {
+  return _mm256_min_ps(a, b);
+}
+S21_SIMD_TARGET("avx2,popcnt") inline __m256 vmax(__m256 a, __m256 b) {
+  return _mm256_max_ps(a, b);
+}
+S21_SIMD_TARGET("avx2,popcnt") inline __m256i vadd(__m256i a, __m256i b) {
+  return _mm256_add_epi32(a, b);
+}
+S21_SIMD_TARGET("avx2,popcnt") inline __m256 vadd(__m256 a, __m256 b) {
+  return _mm256_add_ps(a, b);
+}
+S21_SIMD_TARGET("avx2,popcnt") inline void store(std::int32_t *p, __m256i v) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+}
+S21_SIMD_TARGET("avx2,popcnt") inline void store(float *p, __m256 v) {
+  _mm256_storeu_ps(p, v);
+}
+
+template <typename T>
+using vec_t = decltype(load(static_cast<const T *>(nullptr)));
+
+template <typename T>
+inline constexpr std::ptrdiff_t kLanes = 32 / sizeof(T);
+
+template <typename T>
+S21_SIMD_TARGET("avx2,popcnt")
+const T *find(const T *first, const T *last, T value) {
+  const vec_t<T> needle = splat(value);
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    unsigned mask = eqMask(load(first), needle);
+    if (mask != 0) return first + __builtin_ctz(mask);
+  }
+  return scalar::find(first, last, value);
+}
+
+template <typename T>
+S21_SIMD_TARGET("avx2,popcnt")
+std::size_t count(const T *first, const T *last, T value) {
+  const vec_t<T> needle = splat(value);
+  std::size_t n = 0;
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    n += __builtin_popcount(eqMask(load(first), needle));
+  }
+  return n + scalar::count(first, last, value);
+}
+
+template <typename T, bool Max>
+S21_SIMD_TARGET("avx2,popcnt")
+const T *extremeElement(const T *first, const T *last) {
+  if (last - first < kLanes<T>) {
+    return Max ? scalar::max_element(first, last)
+               : scalar::min_element(first, last);
+  }
+  const T *p = first;
+  vec_t<T> best = load(p);
+  for (p += kLanes<T>; last - p >= kLanes<T>; p += kLanes<T>) {
+    best = Max ? vmax(best, load(p)) : vmin(best, load(p));
+  }
+  T lanes[kLanes<T>];
+  store(lanes, best);
+  T value = Max ? *scalar::max_element(lanes, lanes + kLanes<T>)
+                : *scalar::min_element(lanes, lanes + kLanes<T>);
+  for (; p != last; ++p) {
+    if (Max ? value < *p : *p < value) value = *p;
+  }
+  return find(first, last, value);
+}
+
+template <typename T>
+S21_SIMD_TARGET("avx2,popcnt")
+const T *min_element(const T *first, const T *last) {
+  return extremeElement<T, false>(first, last);
+}
+
+template <typename T>
+S21_SIMD_TARGET("avx2,popcnt")
+const T *max_element(const T *first, const T *last) {
+  return extremeElement<T, true>(first, last);
+}
+
+template <typename T>
+S21_SIMD_TARGET("avx2,popcnt")
+T accumulate(const T *first, const T *last, T init) {
+  vec_t<T> sum = splat(T());
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    sum = vadd(sum, load(first));
+  }
+  T lanes[kLanes<T>];
+  store(lanes, sum);
+  init = scalar::accumulate(lanes, lanes + kLanes<T>, init);
+  return scalar::accumulate(first, last, init);
+}
+
+}  // namespace avx2
+
+namespace avx512 {
+
+S21_SIMD_TARGET("avx512f,popcnt") inline __m512i load(const std::int32_t *p) {
+  return _mm512_loadu_si512(p);
+}
+S21_SIMD_TARGET("avx512f,popcnt") inline __m512 load(const float *p) {
+  return _mm512_loadu_ps(p);
+}
+S21_SIMD_TARGET("avx512f,popcnt") inline __m512i splat(std::int32_t v) {
+  return _mm512_set1_epi32(v);
+}
+S21_SIMD_TARGET("avx512f,popcnt") inline __m512 splat(float v) {
+  return _mm512_set1_ps(v);
+}
+S21_SIMD_TARGET("avx512f,popcnt") inline unsigned eqMask(__m512i a, __m512i b) {
+  return _mm512_cmpeq_epi32_mask(a, b);
+}
+S21_SIMD_TARGET("avx512f,popcnt") inline unsigned eqMask(__m512 a, __m512 b) {
+  return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+}
+// Full-mask forms: the plain ones start from an undefined vector, which
+// GCC 12 reports as maybe-uninitialized.
+S21_SIMD_TARGET("avx512f,popcnt") inline __m512i vmin(__m512i a, __m512i b) {
+  return _mm512_mask_min_epi32(a, 0xFFFF, a, b);
+}
+S21_SIMD_TARGET("avx512f,popcnt") inline __m512i vmax(__m512i a, __m512i b) {
+  return _mm512_mask_max_epi32(a, 0xFFFF, a, b);
+}
+S21_SIMD_TARGET("avx512f,popcnt") inline __m512 vmin(__m512 a, __m512 b) {
+  return _mm512_mask_min_ps(a, 0xFFFF, a, b);
+}
+S21_SIMD_TARGET("avx512f,popcnt") inline __m512 vmax(__m512 a, __m512 b) {
+  return _mm512_mask_max_ps(a, 0xFFFF, a, b);
+}
+S21_SIMD_TARGET("avx512f,popcnt") inline __m512i vadd(__m512i a, __m512i b) {
+  return _mm512_add_epi32(a, b);
+}
+S21_SIMD_TARGET("avx512f,popcnt") inline __m512 vadd(__m512 a, __m512 b) {
+  return _mm512_add_ps(a, b);
+}
+S21_SIMD_TARGET("avx512f,popcnt")
+inline void store(std::int32_t *p, __m512i v) {
+  _mm512_storeu_si512(p, v);
+}
+S21_SIMD_TARGET("avx512f,popcnt") inline void store(float *p, __m512 v) {
+  _mm512_storeu_ps(p, v);
+}
+
+template <typename T>
+using vec_t = decltype(load(static_cast<const T *>(nullptr)));
+
+template <typename T>
+inline constexpr std::ptrdiff_t kLanes = 64 / sizeof(T);
+
+template <typename T>
+S21_SIMD_TARGET("avx512f,popcnt")
+const T *find(const T *first, const T *last, T value) {
+  const vec_t<T> needle = splat(value);
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    unsigned mask = eqMask(load(first), needle);
+    if (mask != 0) return first + __builtin_ctz(mask);
+  }
+  return scalar::find(first, last, value);
+}
+
+template <typename T>
+S21_SIMD_TARGET("avx512f,popcnt")
+std::size_t count(const T *first, const T *last, T value) {
+  const vec_t<T> needle = splat(value);
+  std::size_t n = 0;
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    n += __builtin_popcount(eqMask(load(first), needle));
+  }
+  return n + scalar::count(first, last, value);
+}
+
+template <typename T, bool Max>
+S21_SIMD_TARGET("avx512f,popcnt")
+const T *extremeElement(const T *first, const T *last) {
+  if (last - first < kLanes<T>) {
+    return Max ? scalar::max_element(first, last)
+               : scalar::min_element(first, last);
+  }
+  const T *p = first;
+  vec_t<T> best = load(p);
+  for (p += kLanes<T>; last - p >= kLanes<T>; p += kLanes<T>) {
+    best = Max ? vmax(best, load(p)) : vmin(best, load(p));
+  }
+  T lanes[kLanes<T>];
+  store(lanes, best);
+  T value = Max ? *scalar::max_element(lanes, lanes + kLanes<T>)
+                : *scalar::min_element(lanes, lanes + kLanes<T>);
+  for (; p != last; ++p) {
+    if (Max ? value < *p : *p < value) value = *p;
+  }
+  return find(first, last, value);
+}
+
+template <typename T>
+S21_SIMD_TARGET("avx512f,popcnt")
+const T *min_element(const T *first, const T *last) {
+  return extremeElement<T, false>(first, last);
+}
+
+template <typename T>
+S21_SIMD_TARGET("avx512f,popcnt")
+const T *max_element(const T *first, const T *last) {
+  return extremeElement<T, true>(first, last);
+}
+
+template <typename T>
+S21_SIMD_TARGET("avx512f,popcnt")
+T accumulate(const T *first, const T *last, T init) {
+  vec_t<T> sum = splat(T());
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    sum = vadd(sum, load(first));
+  }
+  T lanes[kLanes<T>];
+  store(lanes, sum);
+  init = scalar::accumulate(lanes, lanes + kLanes<T>, init);
+  return scalar::accumulate(first, last, init);
+}
+
+}  // namespace avx512
+
+#undef S21_SIMD_TARGET
+
+#endif  // S21_SIMD_X86
+
+// The kernels for level, or for the detected ISA if the CPU lacks level.
+template <typename T>
+const kernels<T> &kernels_for(isa level) {
+  static_assert(is_vectorizable_v<T>, "no vector kernels for this type");
+  static const kernels<T> table[] = {
+      {scalar::find<T>, scalar::count<T>, scalar::min_element<T>,
+       scalar::max_element<T>, scalar::accumulate<T>},
+#if S21_SIMD_X86
+      {sse2::find<T>, sse2::count<T>, sse2::min_element<T>,
+       sse2::max_element<T>, sse2::accumulate<T>},
+      {avx2::find<T>, avx2::count<T>, avx2::min_element<T>,
+       avx2::max_element<T>, avx2::accumulate<T>},
+      {avx512::find<T>, avx512::count<T>, avx512::min_element<T>,
+       avx512::max_element<T>, avx512::accumulate<T>},
+#endif
+  };
+  if (level > detected_isa()) level = detected_isa();
+  return table[static_cast<int>(level)];
+}
+
+template <typename T>
+const kernels<T> &active_kernels() {
+  static const kernels<T> &active = kernels_for<T>(detected_isa());
+  return active;
+}
+
+// Pointer interface: T may be const; the value is converted to T, so
+// find(floats, floats + n, 1.0) works as it does with std::find.
+
+template <typename T>
+T *find(T *first, T *last, const std::remove_const_t<T> &value) {
+  using U = std::remove_const_t<T>;
+  const U *found;
+  if constexpr (is_vectorizable_v<U>) {
+    found = active_kernels<U>().find(first, last, value);
+  } else {
+    found = scalar::find<U>(first, last, value);
+  }
+  return first + (found - first);
+}
+
+template <typename T>
+std::size_t count(const T *first, const T *last,
+                  const std::remove_const_t<T> &value) {
+  using U = std::remove_const_t<T>;
+  if constexpr (is_vectorizable_v<U>) {
+    return active_kernels<U>().count(first, last, value);
+  } else {
+    return scalar::count<U>(first, last, value);
+  }
+}
+
+template <typename T>
+T *min_element(T *first, T *last) {
+  using U = std::remove_const_t<T>;
+  const U *found;
+  if constexpr (is_vectorizable_v<U>) {
+    found = active_kernels<U>().min_element(first, last);
+  } else {
+    found = scalar::min_element<U>(first, last);
+  }
+  return first + (found - first);
+}
+
+template <typename T>
+T *max_element(T *first, T *last) {
+  using U = std::remove_const_t<T>;
+  const U *found;
+  if constexpr (is_vectorizable_v<U>) {
+    found = active_kernels<U>().max_element(first, last);
+  } else {
+    found = scalar::max_element<U>(first, last);
+  }
+  return first + (found - first);
+}
+
+template <typename T>
+std::remove_const_t<T> accumulate(T *first, T *last,
+                                  std::remove_const_t<T> init) {
+  using U = std::remove_const_t<T>;
+  if constexpr (is_vectorizable_v<U>) {
+    return active_kernels<U>().accumulate(first, last, init);
+  } else {
+    return scalar::accumulate<U>(first, last, init);
+  }
+}
+
+template <typename T>
+bool contains(const T *first, const T *last,
+              const std::remove_const_t<T> &value) {
+  return find(first, last, value) != last;
+}
+
+// Container interface for anything with data() and size(), such as
+// s21::vector and s21::array. Positions come back as pointers, which are
+// the iterators of both. Views such as soa_vector columns may be passed as
+// temporaries.
+
+template <typename Container>
+using element_t =
+    std::remove_pointer_t<decltype(std::declval<Container &>().data())>;
+
+template <typename Container>
+auto find(Container &&c,
+          const std::remove_const_t<element_t<Container>> &value)
+    -> decltype(c.data()) {
+  return find(c.data(), c.data() + c.size(), value);
+}
+
+template <typename Container>
+std::size_t count(Container &&c,
+                  const std::remove_const_t<element_t<Container>> &value) {
+  return count(c.data(), c.data() + c.size(), value);
+}
+
+template <typename Container>
+auto min_element(Container &&c) -> decltype(c.data()) {
+  return min_element(c.data(), c.data() + c.size());
+}
+
+template <typename Container>
+auto max_element(Container &&c) -> decltype(c.data()) {
+  return max_element(c.data(), c.data() + c.size());
+}
+
+template <typename Container>
+std::remove_const_t<element_t<Container>> accumulate(
+    Container &&c, std::remove_const_t<element_t<Container>> init) {
+  return accumulate(c.data(), c.data() + c.size(), init);
+}
+
+template <typename Container>
+bool contains(Container &&c,
+              const std::remove_const_t<element_t<Container>> &value) {
+  return contains(c.data(), c.data() + c.size(), value);
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#undef S21_SIMD_X86
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_SIMD_S21_SIMD_H
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../array/s21_array.h"
+#include "../vector/s21_vector.h"
+#include "s21_simd.h"
+
+namespace {
+
+using s21::simd::isa;
+
+std::vector<isa> availableLevels() {
+  std::vector<isa> levels;
+  for (isa level : {isa::scalar, isa::sse2, isa::avx2, isa::avx512}) {
+    if (level <= s21::simd::detected_isa()) levels.push_back(level);
+  }
+  return levels;
+}
+
+// Every length up to a few vectors, so each tail size is covered.
+template <typename T>
+void checkAgainstStd(isa level) {
+  SCOPED_TRACE(s21::simd::isa_name(level));
+  const s21::simd::kernels<T> &k = s21::simd::kernels_for<T>(level);
+  std::mt19937 random(7);
+  for (int n = 0; n <= 100; ++n) {
+    std::vector<T> data(n);
+    for (T &x : data) x = static_cast<T>(random() % 50) - 25;
+    const T *first = data.data();
+    const T *last = first + n;
+    for (T needle : {T(-25), T(0), T(3), T(99)}) {
+      EXPECT_EQ(k.find(first, last, needle), std::find(first, last, needle));
+      EXPECT_EQ(k.count(first, last, needle),
+                static_cast<std::size_t>(std::count(first, last, needle)));
+    }
+    EXPECT_EQ(k.min_element(first, last), std::min_element(first, last));
+    EXPECT_EQ(k.max_element(first, last), std::max_element(first, last));
+    EXPECT_EQ(k.accumulate(first, last, T(5)),
+              std::accumulate(first, last, T(5)));
+  }
+}
+
+}  // namespace
+
+TEST(Simd, Int32KernelsMatchStd) {
+  for (isa level : availableLevels()) checkAgainstStd<std::int32_t>(level);
+}
+
+TEST(Simd, FloatKernelsMatchStd) {
+  // Small integral values keep the float sums exact in any order.
+  for (isa level : availableLevels()) checkAgainstStd<float>(level);
+}
+
+TEST(Simd, ExtremesReportFirstOccurrence) {
+  std::vector<std::int32_t> data(1000, 7);
+  data[700] = -3;
+  data[900] = -3;
+  data[10] = 42;
+  data[999] = 42;
+  for (isa level : availableLevels()) {
+    const auto &k = s21::simd::kernels_for<std::int32_t>(level);
+    EXPECT_EQ(k.min_element(data.data(), data.data() + 1000),
+              data.data() + 700);
+    EXPECT_EQ(k.max_element(data.data(), data.data() + 1000),
+              data.data() + 10);
+  }
+}
+
+TEST(Simd, IntegerSumsWrap) {
+  std::vector<std::int32_t> data(64, std::numeric_limits<std::int32_t>::max());
+  for (isa level : availableLevels()) {
+    const auto &k = s21::simd::kernels_for<std::int32_t>(level);
+    EXPECT_EQ(k.accumulate(data.data(), data.data() + 64, 0), -64);
+  }
+}
+
+TEST(Simd, FloatEqualityFollowsIeee) {
+  std::vector<float> data(40, 1.0f);
+  data[33] = -0.0f;
+  data[35] = std::numeric_limits<float>::quiet_NaN();
+  for (isa level : availableLevels()) {
+    const auto &k = s21::simd::kernels_for<float>(level);
+    const float *first = data.data();
+    EXPECT_EQ(k.find(first, first + 40, 0.0f), first + 33);
+    EXPECT_EQ(k.find(first, first + 40, data[35]), first + 40);
+    EXPECT_EQ(k.count(first, first + 40, 1.0f), 38U);
+  }
+}
+
+TEST(Simd, WorksOnS21Containers) {
+  s21::vector<std::int32_t> v;
+  for (std::int32_t i = 0; i < 1000; ++i) v.push_back(i % 100);
+  EXPECT_EQ(s21::simd::find(v, 57), v.begin() + 57);
+  *s21::simd::find(v, 99) = 500;
+  EXPECT_EQ(s21::simd::max_element(v), v.begin() + 99);
+  EXPECT_EQ(s21::simd::count(v, 3), 10U);
+  EXPECT_TRUE(s21::simd::contains(v, 500));
+  EXPECT_FALSE(s21::simd::contains(v, -1));
+  EXPECT_EQ(s21::simd::accumulate(v, 0), 49500 + 401);
+
+  const s21::vector<std::int32_t> &cv = v;
+  EXPECT_EQ(s21::simd::min_element(cv), cv.data());
+
+  s21::array<float, 20> a;
+  a.fill(2.5f);
+  a[17] = -1.0f;
+  EXPECT_EQ(s21::simd::min_element(a), a.begin() + 17);
+  EXPECT_EQ(s21::simd::find(a, -1.0), a.begin() + 17);
+  EXPECT_FLOAT_EQ(s21::simd::accumulate(a, 0.0f), 19 * 2.5f - 1.0f);
+}
+
+TEST(Simd, OtherTypesUseScalarLoops) {
+  std::string words[] = {"b", "a", "c", "a"};
+  EXPECT_EQ(s21::simd::find(words, words + 4, std::string("c")), words + 2);
+  EXPECT_EQ(s21::simd::count(words, words + 4, std::string("a")), 2U);
+  EXPECT_EQ(s21::simd::min_element(words, words + 4), words + 1);
+  EXPECT_EQ(s21::simd::accumulate(words, words + 4, std::string()), "baca");
+
+  s21::vector<double> d = {1.5, -2.0, 4.0};
+  EXPECT_EQ(s21::simd::max_element(d), d.begin() + 2);
+  EXPECT_DOUBLE_EQ(s21::simd::accumulate(d, 0.0), 3.5);
+}
@@ -0,0 +1,384 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_SMALL_VECTOR_S21_SMALL_VECTOR_H
+#define CPP2_S21_CONTAINERS_2_SRC_SMALL_VECTOR_S21_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// s21::vector with room for N elements inside the object itself: nothing is
+// allocated until the N + 1st element, and then growth doubles as usual.
+// Heap buffers are handed to and taken from s21::vector without touching
+// the elements.
+//
+// Unlike vector, clear() keeps the object usable without an allocation: it
+// frees a heap buffer and falls back to the inline one, so capacity()
+// becomes N.
+template <typename T, std::size_t N = 8>
+class small_vector {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  static_assert(N > 0, "small_vector needs inline room for an element");
+
+  small_vector() noexcept : data_(inlineData()), size_(0U), capacity_(N) {}
+
+  explicit small_vector(size_type n) : small_vector() {
+    reserve(n);
+    std::uninitialized_value_construct_n(data_, n);
+    size_ = n;
+  }
+
+  small_vector(std::initializer_list<value_type> const &items)
+      : small_vector() {
+    reserve(items.size());
+    std::uninitialized_copy(items.begin(), items.end(), data_);
+    size_ = items.size();
+  }
+
+  small_vector(const small_vector &other) : small_vector() {
+    reserve(other.size_);
+    std::uninitialized_copy(other.begin(), other.end(), data_);
+    size_ = other.size_;
+  }
+
+  small_vector(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : small_vector() {
+    takeFrom(other);
+  }
+
+  explicit small_vector(const vector<value_type> &other) : small_vector() {
+    reserve(other.size());
+    std::uninitialized_copy(other.cbegin(), other.cend(), data_);
+    size_ = other.size();
+  }
+
+  // Takes over other's buffer, however small, instead of moving elements.
+  explicit small_vector(vector<value_type> &&other) noexcept : small_vector() {
+    if (other.vector_ != nullptr) {
+      data_ = std::exchange(other.vector_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      capacity_ = std::exchange(other.capacity_, 0);
+    }
+  }
+
+  ~small_vector() { clear(); }
+
+  small_vector &operator=(const small_vector &other) {
+    if (this != &other) {
+      destroyElements();
+      reserve(other.size_);
+      std::uninitialized_copy(other.begin(), other.end(), data_);
+      size_ = other.size_;
+    }
+    return *this;
+  }
+
+  small_vector &operator=(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this != &other) {
+      clear();
+      takeFrom(other);
+    }
+    return *this;
+  }
+
+  // A heap buffer is handed over as is; inline elements are moved into a
+  // buffer of exactly size() slots.
+  vector<value_type> to_vector() && {
+    vector<value_type> result;
+    if (onHeap()) {
+      result.vector_ = std::exchange(data_, inlineData());
+      result.size_ = std::exchange(size_, 0);
+      result.capacity_ = std::exchange(capacity_, N);
+    } else {
+      result.reserve(size_);
+      vector<value_type>::relocate(data_, size_, result.vector_);
+      result.size_ = size_;
+      destroyElements();
+    }
+    return result;
+  }
+
+  vector<value_type> to_vector() const & {
+    vector<value_type> result;
+    result.insert(result.cend(), begin(), end());
+    return result;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Out of range");
+    return data_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Out of range");
+    return data_[pos];
+  }
+
+  reference operator[](size_type pos) { return data_[pos]; }
+  const_reference operator[](size_type pos) const { return data_[pos]; }
+  reference front() { return data_[0]; }
+  const_reference front() const { return data_[0]; }
+  reference back() { return data_[size_ - 1]; }
+  const_reference back() const { return data_[size_ - 1]; }
+  iterator data() { return data_; }
+  const_iterator data() const { return data_; }
+
+  iterator begin() { return data_; }
+  const_iterator begin() const { return data_; }
+  const_iterator cbegin() const { return data_; }
+  iterator end() { return data_ + size_; }
+  const_iterator end() const { return data_ + size_; }
+  const_iterator cend() const { return data_ + size_; }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+  size_type capacity() const { return capacity_; }
+  // True while the elements live inside the object.
+  bool is_inline() const { return !onHeap(); }
+
+  void reserve(size_type size) {
+    if (size > max_size()) throw std::exception();
+    if (size > capacity_) reallocate(size);
+  }
+
+  // Moves back into the inline buffer when the elements fit there.
+  void shrink_to_fit() {
+    if (!onHeap() || capacity_ == size_) return;
+    if (size_ > N) {
+      reallocate(size_);
+      return;
+    }
+    value_type *heap = data_;
+    vector<value_type>::relocate(heap, size_, inlineData());
+    std::destroy_n(heap, size_);
+    std::allocator<value_type>().deallocate(heap, capacity_);
+    data_ = inlineData();
+    capacity_ = N;
+  }
+
+  void clear() {
+    destroyElements();
+    if (onHeap()) {
+      std::allocator<value_type>().deallocate(data_, capacity_);
+      data_ = inlineData();
+      capacity_ = N;
+    }
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    value_type copy(value);
+    return insertGap(pos - cbegin(), 1, [&copy](value_type *dest) {
+      new (dest) value_type(std::move(copy));
+    });
+  }
+
+  iterator insert(const_iterator pos, size_type count, const_reference value) {
+    value_type copy(value);
+    return insertGap(pos - cbegin(), count, [&](value_type *dest) {
+      std::uninitialized_fill_n(dest, count, copy);
+    });
+  }
+
+  // [first, last) must be a multi-pass range outside this vector.
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type count = 0;
+    for (InputIt it = first; it != last; ++it) ++count;
+    return insertGap(pos - cbegin(), count, [&](value_type *dest) {
+      value_type *slot = dest;
+      try {
+        for (InputIt it = first; it != last; ++it, ++slot) {
+          new (slot) value_type(*it);
+        }
+      } catch (...) {
+        std::destroy(dest, slot);
+        throw;
+      }
+    });
+  }
+
+  iterator erase(const_iterator pos) {
+    const size_type index = pos - cbegin();
+    std::move(begin() + index + 1, end(), data_ + index);
+    pop_back();
+    return begin() + index;
+  }
+
+  void push_back(const_reference value) {
+    if (size_ == capacity_) {
+      insertGap(size_, 1,
+                [&value](value_type *dest) { new (dest) value_type(value); });
+    } else {
+      new (data_ + size_) value_type(value);
+      ++size_;
+    }
+  }
+
+  void pop_back() {
+    if (size_ != 0) {
+      --size_;
+      data_[size_].~value_type();
+    }
+  }
+
+  void swap(small_vector &other) {
+    if (this == &other) return;
+    if (onHeap() && other.onHeap()) {
+      std::swap(data_, other.data_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+      return;
+    }
+    small_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    constexpr size_type count = sizeof...(Args);
+    const size_type index = pos - cbegin();
+    if constexpr (count == 0) {
+      return begin() + index;
+    } else {
+      // Materialized first so arguments may refer to elements of this
+      // vector; cheap next to the heap allocation this type avoids.
+      value_type items[] = {value_type(std::forward<Args>(args))...};
+      return insert(cbegin() + index, std::make_move_iterator(items),
+                    std::make_move_iterator(items + count)) +
+             count;
+    }
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    insert_many(cend(), std::forward<Args>(args)...);
+  }
+
+ private:
+  value_type *inlineData() { return reinterpret_cast<value_type *>(inline_); }
+  bool onHeap() const {
+    return data_ != reinterpret_cast<const value_type *>(inline_);
+  }
+
+  void destroyElements() {
+    std::destroy_n(data_, size_);
+    size_ = 0;
+  }
+
+  // Moves other's elements here; this vector must be empty and inline.
+  void takeFrom(small_vector &other) {
+    if (other.onHeap()) {
+      data_ = std::exchange(other.data_, other.inlineData());
+      size_ = std::exchange(other.size_, 0);
+      capacity_ = std::exchange(other.capacity_, N);
+    } else {
+      std::uninitialized_move(other.begin(), other.end(), data_);
+      size_ = other.size_;
+      other.destroyElements();
+    }
+  }
+
+  void adopt(value_type *storage, size_type n) {
+    std::destroy_n(data_, size_);
+    if (onHeap()) std::allocator<value_type>().deallocate(data_, capacity_);
+    data_ = storage;
+    capacity_ = n;
+  }
+
+  void reallocate(size_type n) {
+    value_type *storage = std::allocator<value_type>().allocate(n);
+    try {
+      vector<value_type>::relocate(data_, size_, storage);
+    } catch (...) {
+      std::allocator<value_type>().deallocate(storage, n);
+      throw;
+    }
+    adopt(storage, n);
+  }
+
+  // Same contract as vector::insertGap.
+  template <typename Construct>
+  iterator insertGap(size_type index, size_type count, Construct construct) {
+    constexpr bool kShiftInPlace =
+        std::is_trivially_copyable_v<value_type> ||
+        (std::is_nothrow_move_constructible_v<value_type> &&
+         std::is_nothrow_move_assignable_v<value_type>);
+    if (count == 0) return begin() + index;
+    if (count > capacity_ - size_ || (!kShiftInPlace && index != size_)) {
+      if (count > max_size() - size_) throw std::exception();
+      size_type n = capacity_;
+      if (count > capacity_ - size_) {
+        n = std::min(std::max(capacity_ * 2, size_ + count), max_size());
+      }
+      std::allocator<value_type> allocator;
+      value_type *storage = allocator.allocate(n);
+      try {
+        construct(storage + index);
+      } catch (...) {
+        allocator.deallocate(storage, n);
+        throw;
+      }
+      try {
+        vector<value_type>::relocate(data_, index, storage);
+      } catch (...) {
+        std::destroy_n(storage + index, count);
+        allocator.deallocate(storage, n);
+        throw;
+      }
+      try {
+        vector<value_type>::relocate(data_ + index, size_ - index,
+                                     storage + index + count);
+      } catch (...) {
+        std::destroy_n(storage, index + count);
+        allocator.deallocate(storage, n);
+        throw;
+      }
+      adopt(storage, n);
+    } else if constexpr (std::is_trivially_copyable_v<value_type>) {
+      value_type *gap = data_ + index;
+      std::size_t tail = (size_ - index) * sizeof(value_type);
+      std::memmove(gap + count, gap, tail);
+      try {
+        construct(gap);
+      } catch (...) {
+        std::memmove(gap, gap + count, tail);
+        throw;
+      }
+    } else {
+      construct(data_ + size_);
+      std::rotate(data_ + index, data_ + size_, data_ + size_ + count);
+    }
+    size_ += count;
+    return begin() + index;
+  }
+
+  value_type *data_;
+  size_type size_;
+  size_type capacity_;
+  alignas(value_type) unsigned char inline_[N * sizeof(value_type)];
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_SMALL_VECTOR_S21_SMALL_VECTOR_H
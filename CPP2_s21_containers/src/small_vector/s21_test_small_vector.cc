@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "s21_small_vector.h"
+
+namespace {
+
+using small = s21::small_vector<std::string, 4>;
+
+template <typename Vector>
+void expectContents(const Vector &v, std::initializer_list<std::string> list) {
+  ASSERT_EQ(v.size(), list.size());
+  std::size_t i = 0;
+  for (const auto &item : list) EXPECT_EQ(v[i++], item);
+}
+
+// Copies are its only moves, and the one numbered fail_at throws.
+struct CopyThrows {
+  explicit CopyThrows(int value) : value(value) { ++live; }
+  CopyThrows(const CopyThrows &other) : value(other.value) {
+    if (copies++ == fail_at) throw std::runtime_error("copy");
+    ++live;
+  }
+  CopyThrows &operator=(const CopyThrows &other) = default;
+  ~CopyThrows() { --live; }
+
+  static inline int copies = 0;
+  static inline int fail_at = -1;
+  static inline int live = 0;
+  int value;
+};
+
+}  // namespace
+
+TEST(small_vector, StaysInlineUpToN) {
+  small v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), 4U);
+  EXPECT_TRUE(v.is_inline());
+  for (int i = 0; i < 4; ++i) v.push_back(std::to_string(i));
+  EXPECT_TRUE(v.is_inline());
+  v.push_back("4");
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 8U);
+  expectContents(v, {"0", "1", "2", "3", "4"});
+  v.pop_back();
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.is_inline());
+  expectContents(v, {"0", "1", "2", "3"});
+  v.push_back("x");
+  v.clear();
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4U);
+}
+
+TEST(small_vector, Constructors) {
+  s21::small_vector<int, 3> sized(5);
+  EXPECT_EQ(sized.size(), 5U);
+  for (int value : sized) EXPECT_EQ(value, 0);
+  small items{"a", "b"};
+  small copy(items);
+  expectContents(copy, {"a", "b"});
+  small big{"a", "b", "c", "d", "e", "f"};
+  small big_copy(big);
+  expectContents(big_copy, {"a", "b", "c", "d", "e", "f"});
+  EXPECT_THROW(big.at(6), std::out_of_range);
+  EXPECT_EQ(big.at(5), "f");
+  EXPECT_EQ(big.front(), "a");
+  EXPECT_EQ(big.back(), "f");
+}
+
+TEST(small_vector, MoveStealsHeapAndMovesInline) {
+  small inline_items{"a", "b"};
+  small moved(std::move(inline_items));
+  expectContents(moved, {"a", "b"});
+  EXPECT_TRUE(inline_items.empty());
+
+  small heap{"a", "b", "c", "d", "e"};
+  const std::string *first = &heap[0];
+  small stolen(std::move(heap));
+  EXPECT_EQ(&stolen[0], first);
+  EXPECT_TRUE(heap.empty());
+  EXPECT_TRUE(heap.is_inline());
+
+  moved = std::move(stolen);
+  expectContents(moved, {"a", "b", "c", "d", "e"});
+  stolen = moved;
+  expectContents(stolen, {"a", "b", "c", "d", "e"});
+}
+
+TEST(small_vector, SwapMixesInlineAndHeap) {
+  small a{"a"};
+  small b{"1", "2", "3", "4", "5"};
+  a.swap(b);
+  expectContents(a, {"1", "2", "3", "4", "5"});
+  expectContents(b, {"a"});
+  small c{"x", "y", "z", "w", "v", "u"};
+  a.swap(c);
+  expectContents(a, {"x", "y", "z", "w", "v", "u"});
+  expectContents(c, {"1", "2", "3", "4", "5"});
+}
+
+TEST(small_vector, InsertAndErase) {
+  small v{"a", "e"};
+  auto it = v.insert(v.begin() + 1, "b");
+  EXPECT_EQ(*it, "b");
+  std::list<std::string> more{"c", "d"};
+  v.insert(v.begin() + 2, more.begin(), more.end());
+  expectContents(v, {"a", "b", "c", "d", "e"});
+  v.insert(v.end(), 2, v[0]);
+  it = v.insert_many(v.cbegin(), "x", v[1]);
+  EXPECT_EQ(it - v.begin(), 2);
+  v.insert_many_back("z");
+  expectContents(v, {"x", "b", "a", "b", "c", "d", "e", "a", "a", "z"});
+  it = v.erase(v.begin());
+  EXPECT_EQ(*it, "b");
+  EXPECT_EQ(v.size(), 9U);
+}
+
+TEST(small_vector, ConvertsToAndFromVector) {
+  s21::vector<std::string> source{"a", "b", "c", "d", "e", "f"};
+  const std::string *buffer = source.data();
+  small from(std::move(source));
+  EXPECT_EQ(from.data(), buffer);
+  EXPECT_EQ(source.size(), 0U);
+  s21::vector<std::string> back = std::move(from).to_vector();
+  EXPECT_EQ(back.data(), buffer);
+  EXPECT_TRUE(from.empty());
+  EXPECT_TRUE(from.is_inline());
+
+  small few{"p", "q"};
+  s21::vector<std::string> copied = few.to_vector();
+  expectContents(copied, {"p", "q"});
+  expectContents(few, {"p", "q"});
+  s21::vector<std::string> taken = std::move(few).to_vector();
+  expectContents(taken, {"p", "q"});
+  EXPECT_EQ(taken.capacity(), 2U);
+  EXPECT_TRUE(few.empty());
+  small copy_of(taken);
+  expectContents(copy_of, {"p", "q"});
+  EXPECT_TRUE(copy_of.is_inline());
+}
+
+TEST(small_vector, MoveOnlyElements) {
+  s21::small_vector<std::unique_ptr<int>, 2> v;
+  v.insert_many_back(std::make_unique<int>(1), std::make_unique<int>(2),
+                     std::make_unique<int>(3));
+  EXPECT_FALSE(v.is_inline());
+  s21::small_vector<std::unique_ptr<int>, 2> moved(std::move(v));
+  ASSERT_EQ(moved.size(), 3U);
+  EXPECT_EQ(*moved[2], 3);
+  moved.erase(moved.begin());
+  EXPECT_EQ(*moved[0], 2);
+}
+
+TEST(small_vector, ThrowingShiftLeavesVectorUnchanged) {
+  {
+    s21::small_vector<CopyThrows, 16> v;
+    for (int i = 0; i < 5; ++i) v.push_back(CopyThrows(i));
+    CopyThrows nine(9);
+    CopyThrows::copies = 0;
+    CopyThrows::fail_at = 3;  // the first copy that shifts the tail
+    EXPECT_THROW(v.insert(v.cbegin() + 1, 2, nine), std::runtime_error);
+    CopyThrows::fail_at = -1;
+    ASSERT_EQ(v.size(), 5U);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i].value, i);
+    EXPECT_EQ(CopyThrows::live, 6);
+
+    v.insert(v.cbegin() + 1, 2, nine);
+    ASSERT_EQ(v.size(), 7U);
+    EXPECT_EQ(v[2].value, 9);
+    EXPECT_EQ(v[3].value, 1);
+  }
+  EXPECT_EQ(CopyThrows::live, 0);
+
+  s21::small_vector<int, 8> ints = {1, 2, 5};
+  ints.insert(ints.cbegin() + 2, 2, ints[2]);
+  ints.insert(ints.cbegin() + 2, 3);
+  ASSERT_EQ(ints.size(), 6U);
+  EXPECT_EQ(ints[1], 2);
+  EXPECT_EQ(ints[2], 3);
+  EXPECT_EQ(ints[3], 5);
+  EXPECT_EQ(ints[5], 5);
+}
@@ -0,0 +1,461 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_SOA_VECTOR_S21_SOA_VECTOR_H
+#define CPP2_S21_CONTAINERS_2_SRC_SOA_VECTOR_S21_SOA_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Contiguous view of one soa_vector column. Iterators are plain pointers,
+// so the simd and parallel algorithms take a column directly.
+template <typename T>
+class column_span {
+ public:
+  using value_type = std::remove_const_t<T>;
+  using reference = T &;
+  using iterator = T *;
+  using size_type = size_t;
+
+  column_span() noexcept = default;
+  column_span(T *data, size_type size) noexcept : data_(data), size_(size) {}
+
+  reference operator[](size_type pos) const { return data_[pos]; }
+  reference front() const { return data_[0]; }
+  reference back() const { return data_[size_ - 1]; }
+  iterator data() const { return data_; }
+  iterator begin() const { return data_; }
+  iterator end() const { return data_ + size_; }
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+
+ private:
+  T *data_ = nullptr;
+  size_type size_ = 0;
+};
+
+// Structure of arrays: row i of a soa_vector<A, B, C> is spread over three
+// columns, each a separate buffer aligned to a cache line, so a loop over
+// one field streams only that field through the cache. Rows are read and
+// written through tuples of references; column<I>() exposes field I as a
+// contiguous span.
+//
+// Growth doubles every column at once with vector's guarantee: if it
+// throws, the rows are left as they were.
+// The iterator yields tuples of references, so it suits range-for with
+// structured bindings but not algorithms that swap through value_type.
+template <typename... Fields>
+class soa_vector {
+  template <bool Const>
+  class zip_iterator;
+
+ public:
+  static_assert(sizeof...(Fields) > 0, "soa_vector needs a field");
+
+  using value_type = std::tuple<Fields...>;
+  using reference = std::tuple<Fields &...>;
+  using const_reference = std::tuple<const Fields &...>;
+  using iterator = zip_iterator<false>;
+  using const_iterator = zip_iterator<true>;
+  using size_type = size_t;
+
+  template <std::size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  static constexpr std::size_t kAlignment = 64;
+
+  soa_vector() noexcept = default;
+
+  soa_vector(std::initializer_list<value_type> const &items) {
+    reserve(items.size());
+    for (const value_type &item : items) push_back(item);
+  }
+
+  soa_vector(const soa_vector &other)
+      : columns_(buildColumns(other.size_, other.size_,
+                              [&other](auto index, auto *dest) {
+                                std::uninitialized_copy_n(
+                                    std::get<decltype(index)::value>(
+                                        other.columns_),
+                                    other.size_, dest);
+                              })),
+        size_(other.size_),
+        capacity_(other.size_) {}
+
+  soa_vector(soa_vector &&other) noexcept { swap(other); }
+
+  ~soa_vector() { release(); }
+
+  soa_vector &operator=(const soa_vector &other) {
+    if (this != &other) {
+      soa_vector copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  soa_vector &operator=(soa_vector &&other) noexcept {
+    if (this != &other) {
+      release();
+      swap(other);
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Out of range");
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Out of range");
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) {
+    return row(pos, std::index_sequence_for<Fields...>());
+  }
+  const_reference operator[](size_type pos) const {
+    return row(pos, std::index_sequence_for<Fields...>());
+  }
+  reference front() { return (*this)[0]; }
+  const_reference front() const { return (*this)[0]; }
+  reference back() { return (*this)[size_ - 1]; }
+  const_reference back() const { return (*this)[size_ - 1]; }
+
+  template <std::size_t I>
+  column_span<field_type<I>> column() {
+    return {std::get<I>(columns_), size_};
+  }
+
+  template <std::size_t I>
+  column_span<const field_type<I>> column() const {
+    return {std::get<I>(columns_), size_};
+  }
+
+  iterator begin() { return iterator(this, 0); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator cbegin() const { return begin(); }
+  iterator end() { return iterator(this, size_); }
+  const_iterator end() const { return const_iterator(this, size_); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / (sizeof(Fields) + ...) /
+           2;
+  }
+  size_type capacity() const { return capacity_; }
+
+  void reserve(size_type size) {
+    if (size > max_size()) throw std::exception();
+    if (size > capacity_) reallocate(size);
+  }
+
+  void shrink_to_fit() {
+    if (capacity_ != size_) reallocate(size_);
+  }
+
+  void clear() {
+    forEachColumn([this](auto index) {
+      std::destroy_n(std::get<decltype(index)::value>(columns_), size_);
+    });
+    size_ = 0;
+  }
+
+  void push_back(const value_type &value) {
+    growIfFull();
+    std::apply([this](const Fields &...fields) { constructBack(fields...); },
+               value);
+  }
+
+  void push_back(value_type &&value) {
+    growIfFull();
+    std::apply(
+        [this](Fields &...fields) { constructBack(std::move(fields)...); },
+        value);
+  }
+
+  // Takes one argument per field.
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    static_assert(sizeof...(Args) == sizeof...(Fields),
+                  "emplace_back takes one argument per field");
+    if (size_ == capacity_) {
+      // Built first: the arguments may refer to rows that growth moves.
+      push_back(value_type(std::forward<Args>(args)...));
+    } else {
+      constructBack(std::forward<Args>(args)...);
+    }
+    return back();
+  }
+
+  void pop_back() {
+    if (size_ == 0) return;
+    --size_;
+    forEachColumn([this](auto index) {
+      std::destroy_at(std::get<decltype(index)::value>(columns_) + size_);
+    });
+  }
+
+  void swap(soa_vector &other) noexcept {
+    std::swap(columns_, other.columns_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+ private:
+  using columns_type = std::tuple<Fields *...>;
+
+  template <typename F>
+  static constexpr std::align_val_t alignmentOf() {
+    return std::align_val_t(std::max(kAlignment, alignof(F)));
+  }
+
+  template <typename F>
+  static F *allocateColumn(size_type n) {
+    if (n == 0) return nullptr;
+    return static_cast<F *>(::operator new(n * sizeof(F), alignmentOf<F>()));
+  }
+
+  template <typename F>
+  static void deallocateColumn(F *column) {
+    if (column != nullptr) ::operator delete(column, alignmentOf<F>());
+  }
+
+  template <typename Visit, std::size_t... I>
+  static void forEachIndex(Visit &visit, std::index_sequence<I...>) {
+    (visit(std::integral_constant<std::size_t, I>()), ...);
+  }
+
+  // Calls visit(std::integral_constant<size_t, I>()) for every column I.
+  template <typename Visit>
+  static void forEachColumn(Visit visit) {
+    forEachIndex(visit, std::index_sequence_for<Fields...>());
+  }
+
+  // Allocates columns of n slots, then has fill(index, dest) construct the
+  // first count elements of each. Every allocation happens before the first
+  // fill, and columns whose type may throw on a move are filled before the
+  // rest, so a relocation that moves elements out only starts once nothing
+  // can fail any more. On failure nothing is left allocated.
+  template <typename Fill>
+  static columns_type buildColumns(size_type n, size_type count, Fill fill) {
+    columns_type fresh{};
+    bool filled[sizeof...(Fields)] = {};
+    try {
+      forEachColumn([&](auto index) {
+        constexpr std::size_t i = decltype(index)::value;
+        std::get<i>(fresh) = allocateColumn<field_type<i>>(n);
+      });
+      for (bool may_throw : {true, false}) {
+        forEachColumn([&](auto index) {
+          constexpr std::size_t i = decltype(index)::value;
+          if (std::is_nothrow_move_constructible_v<field_type<i>> ==
+              may_throw) {
+            return;
+          }
+          fill(index, std::get<i>(fresh));
+          filled[i] = true;
+        });
+      }
+    } catch (...) {
+      forEachColumn([&](auto index) {
+        constexpr std::size_t i = decltype(index)::value;
+        if (filled[i]) std::destroy_n(std::get<i>(fresh), count);
+        deallocateColumn(std::get<i>(fresh));
+      });
+      throw;
+    }
+    return fresh;
+  }
+
+  void release() {
+    clear();
+    forEachColumn([this](auto index) {
+      deallocateColumn(std::get<decltype(index)::value>(columns_));
+    });
+    columns_ = columns_type{};
+    capacity_ = 0;
+  }
+
+  // A column that vector would copy rather than move on growth makes every
+  // column copy, so a throwing copy finds the old columns all intact.
+  static constexpr bool kCopyOnGrowth =
+      ((!std::is_nothrow_move_constructible_v<Fields> &&
+        std::is_copy_constructible_v<Fields>) ||
+       ...);
+
+  // Relocates every column into fresh storage of n slots; n >= size_.
+  void reallocate(size_type n) {
+    columns_type fresh =
+        buildColumns(n, size_, [this](auto index, auto *dest) {
+          using field = std::remove_pointer_t<decltype(dest)>;
+          field *source = std::get<decltype(index)::value>(columns_);
+          if constexpr (kCopyOnGrowth) {
+            std::uninitialized_copy_n(source, size_, dest);
+          } else {
+            vector<field>::relocate(source, size_, dest);
+          }
+        });
+    size_type count = size_;
+    release();
+    columns_ = fresh;
+    size_ = count;
+    capacity_ = n;
+  }
+
+  void growIfFull() {
+    if (size_ == capacity_) {
+      if (size_ == max_size()) throw std::exception();
+      reserve(std::max<size_type>(capacity_ * 2, 1));
+    }
+  }
+
+  // Constructs row size_ field by field, undoing the row if one throws.
+  template <typename... Args>
+  void constructBack(Args &&...args) {
+    constructBack(std::index_sequence_for<Fields...>(),
+                  std::forward<Args>(args)...);
+    ++size_;
+  }
+
+  template <std::size_t... I, typename... Args>
+  void constructBack(std::index_sequence<I...>, Args &&...args) {
+    std::size_t built = 0;
+    try {
+      ((new (std::get<I>(columns_) + size_) Fields(std::forward<Args>(args)),
+        ++built),
+       ...);
+    } catch (...) {
+      ((I < built ? std::destroy_at(std::get<I>(columns_) + size_) : void()),
+       ...);
+      throw;
+    }
+  }
+
+  template <std::size_t... I>
+  reference row(size_type pos, std::index_sequence<I...>) {
+    return reference(std::get<I>(columns_)[pos]...);
+  }
+
+  template <std::size_t... I>
+  const_reference row(size_type pos, std::index_sequence<I...>) const {
+    return const_reference(std::get<I>(columns_)[pos]...);
+  }
+
+  columns_type columns_{};
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+};
+
+// Random-access iterator over rows; dereferencing yields a tuple of
+// references into the columns.
+template <typename... Fields>
+template <bool Const>
+class soa_vector<Fields...>::zip_iterator {
+  using owner_type = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = soa_vector::value_type;
+  using reference = std::conditional_t<Const, soa_vector::const_reference,
+                                       soa_vector::reference>;
+  using pointer = void;
+  using difference_type = std::ptrdiff_t;
+
+  zip_iterator() noexcept = default;
+  zip_iterator(owner_type *owner, size_type index) noexcept
+      : owner_(owner), index_(index) {}
+
+  // Lets an iterator convert to a const_iterator.
+  template <bool WasConst, typename = std::enable_if_t<Const && !WasConst>>
+  zip_iterator(const zip_iterator<WasConst> &other) noexcept
+      : owner_(other.owner_), index_(other.index_) {}
+
+  reference operator*() const { return (*owner_)[index_]; }
+  reference operator[](difference_type n) const {
+    return (*owner_)[index_ + n];
+  }
+
+  zip_iterator &operator++() {
+    ++index_;
+    return *this;
+  }
+  zip_iterator operator++(int) {
+    zip_iterator old = *this;
+    ++index_;
+    return old;
+  }
+  zip_iterator &operator--() {
+    --index_;
+    return *this;
+  }
+  zip_iterator operator--(int) {
+    zip_iterator old = *this;
+    --index_;
+    return old;
+  }
+  zip_iterator &operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+  zip_iterator &operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+  zip_iterator operator+(difference_type n) const {
+    return zip_iterator(owner_, index_ + n);
+  }
+  friend zip_iterator operator+(difference_type n, const zip_iterator &it) {
+    return it + n;
+  }
+  zip_iterator operator-(difference_type n) const {
+    return zip_iterator(owner_, index_ - n);
+  }
+  difference_type operator-(const zip_iterator &other) const {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  bool operator==(const zip_iterator &other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const zip_iterator &other) const {
+    return index_ != other.index_;
+  }
+  bool operator<(const zip_iterator &other) const {
+    return index_ < other.index_;
+  }
+  bool operator>(const zip_iterator &other) const {
+    return index_ > other.index_;
+  }
+  bool operator<=(const zip_iterator &other) const {
+    return index_ <= other.index_;
+  }
+  bool operator>=(const zip_iterator &other) const {
+    return index_ >= other.index_;
+  }
+
+ private:
+  template <bool>
+  friend class zip_iterator;
+
+  owner_type *owner_ = nullptr;
+  size_type index_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_SOA_VECTOR_S21_SOA_VECTOR_H
@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "../simd/s21_simd.h"
+#include "../thread_pool/s21_parallel.h"
+#include "s21_soa_vector.h"
+
+namespace {
+
+using Particles = s21::soa_vector<std::int32_t, float, std::string>;
+
+bool aligned(const void *p) {
+  return reinterpret_cast<std::uintptr_t>(p) % Particles::kAlignment == 0;
+}
+
+// Throws on the copy numbered `fail_at` counted across all instances.
+struct Fragile {
+  static inline int copies = 0;
+  static inline int fail_at = -1;
+  static inline int alive = 0;
+
+  explicit Fragile(int v) : value(v) { ++alive; }
+  Fragile(const Fragile &other) : value(other.value) {
+    if (copies++ == fail_at) throw std::runtime_error("copy");
+    ++alive;
+  }
+  ~Fragile() { --alive; }
+
+  int value;
+};
+
+}  // namespace
+
+TEST(SoaVector, PushBackAndRowAccess) {
+  Particles p;
+  EXPECT_TRUE(p.empty());
+  for (int i = 0; i < 100; ++i) {
+    p.push_back({i, i * 0.5f, std::to_string(i)});
+  }
+  Particles::value_type row(100, 50.0f, "100");
+  p.push_back(std::move(row));
+  EXPECT_EQ(p.size(), 101U);
+  EXPECT_GE(p.capacity(), 101U);
+
+  auto [id, x, name] = p[42];
+  EXPECT_EQ(id, 42);
+  EXPECT_FLOAT_EQ(x, 21.0f);
+  EXPECT_EQ(name, "42");
+  x = -1.0f;  // the binding refers into the column
+  EXPECT_FLOAT_EQ(p.column<1>()[42], -1.0f);
+
+  EXPECT_EQ(std::get<2>(p.back()), "100");
+  EXPECT_EQ(std::get<0>(p.front()), 0);
+  EXPECT_EQ(std::get<0>(p.at(7)), 7);
+  EXPECT_THROW(p.at(101), std::out_of_range);
+  p.pop_back();
+  EXPECT_EQ(p.size(), 100U);
+}
+
+TEST(SoaVector, EmplaceBackMayReferToItsOwnRows) {
+  Particles p;
+  p.emplace_back(1, 1.5f, "one");
+  for (int i = 0; i < 20; ++i) {
+    auto row = p.emplace_back(std::get<0>(p.back()) + 1, std::get<1>(p[0]),
+                              std::get<2>(p.back()));
+    EXPECT_EQ(std::get<0>(row), i + 2);
+  }
+  EXPECT_EQ(p.size(), 21U);
+  EXPECT_EQ(std::get<2>(p[20]), "one");
+  EXPECT_FLOAT_EQ(std::get<1>(p[20]), 1.5f);
+}
+
+TEST(SoaVector, ColumnsAreSeparateAndAligned) {
+  Particles p;
+  p.reserve(10);
+  for (int i = 0; i < 10; ++i) p.emplace_back(i, 0.0f, "");
+  EXPECT_TRUE(aligned(p.column<0>().data()));
+  EXPECT_TRUE(aligned(p.column<1>().data()));
+  EXPECT_TRUE(aligned(p.column<2>().data()));
+
+  s21::column_span<std::int32_t> ids = p.column<0>();
+  EXPECT_EQ(ids.size(), 10U);
+  EXPECT_EQ(ids.end() - ids.begin(), 10);
+  EXPECT_EQ(ids.data() + 1, &std::get<0>(p[1]));
+  for (std::int32_t &id : ids) id *= 10;
+  EXPECT_EQ(std::get<0>(p[9]), 90);
+
+  const Particles &cp = p;
+  s21::column_span<const std::int32_t> cids = cp.column<0>();
+  EXPECT_EQ(cids.back(), 90);
+  EXPECT_FALSE(cids.empty());
+}
+
+TEST(SoaVector, ZipIteratorWalksRows) {
+  Particles p = {{3, 0.5f, "c"}, {1, 1.5f, "a"}, {2, 2.5f, "b"}};
+  for (auto [id, x, name] : p) {
+    x += static_cast<float>(id);
+    name += "!";
+  }
+  EXPECT_FLOAT_EQ(std::get<1>(p[0]), 3.5f);
+  EXPECT_EQ(std::get<2>(p[2]), "b!");
+
+  Particles::iterator it = p.begin();
+  Particles::const_iterator cit = it;
+  EXPECT_EQ(cit, p.cbegin());
+  EXPECT_EQ(p.end() - p.begin(), 3);
+  EXPECT_EQ(std::get<0>(it[2]), 2);
+  EXPECT_EQ(std::get<0>(*(it + 1)), 1);
+  EXPECT_EQ(std::get<0>(*(2 + it)), 2);
+  ++it;
+  it++;
+  --it;
+  EXPECT_EQ(std::get<2>(*it--), "a!");
+  EXPECT_EQ(it, p.begin());
+  EXPECT_TRUE(p.begin() < p.end());
+  EXPECT_TRUE(p.end() >= p.begin() + 3);
+  EXPECT_EQ(std::distance(p.cbegin(), p.cend()), 3);
+  EXPECT_EQ(std::count_if(p.cbegin(), p.cend(),
+                          [](Particles::const_reference row) {
+                            return std::get<0>(row) > 1;
+                          }),
+            2);
+}
+
+TEST(SoaVector, CopyMoveAndSwap) {
+  Particles a = {{1, 1.0f, "x"}, {2, 2.0f, "y"}};
+  Particles b(a);
+  std::get<2>(b[0]) = "changed";
+  EXPECT_EQ(std::get<2>(a[0]), "x");
+  EXPECT_EQ(b.capacity(), 2U);
+
+  const std::int32_t *ids = a.column<0>().data();
+  Particles c(std::move(a));
+  EXPECT_EQ(c.column<0>().data(), ids);
+  EXPECT_TRUE(a.empty());
+
+  a = c;
+  EXPECT_EQ(std::get<2>(a[1]), "y");
+  b = std::move(c);
+  EXPECT_EQ(std::get<0>(b[1]), 2);
+  a.swap(b);
+  EXPECT_EQ(std::get<2>(a[0]), "x");
+
+  a.reserve(100);
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 2U);
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 0U);
+}
+
+TEST(SoaVector, FailedGrowthKeepsTheRows) {
+  Fragile::copies = 0;
+  Fragile::alive = 0;
+  {
+    s21::soa_vector<int, Fragile> v;
+    for (int i = 0; i < 4; ++i) v.emplace_back(i, Fragile(i));
+    EXPECT_EQ(v.capacity(), 4U);
+    Fragile::copies = 0;
+    Fragile::fail_at = 2;  // Fragile copies on relocation: it may throw
+    EXPECT_THROW(v.emplace_back(4, Fragile(4)), std::runtime_error);
+    Fragile::fail_at = -1;
+    EXPECT_EQ(v.size(), 4U);
+    EXPECT_EQ(v.capacity(), 4U);
+    EXPECT_EQ(std::get<1>(v[3]).value, 3);
+    EXPECT_EQ(Fragile::alive, 4);
+
+    Fragile::copies = 0;
+    Fragile::fail_at = 0;
+    Fragile spare(9);
+    EXPECT_THROW(v.emplace_back(9, spare), std::runtime_error);
+    Fragile::fail_at = -1;
+    EXPECT_EQ(v.size(), 4U);
+  }
+  EXPECT_EQ(Fragile::alive, 0);
+}
+
+TEST(SoaVector, FailedGrowthKeepsMovableColumnsToo) {
+  Fragile::copies = 0;
+  Fragile::alive = 0;
+  {
+    // The string column is relocated before the Fragile one, so it must
+    // not be moved out while a later copy can still throw.
+    s21::soa_vector<std::string, Fragile> v;
+    for (int i = 0; i < 4; ++i) {
+      v.emplace_back(std::string(20, static_cast<char>('a' + i)), Fragile(i));
+    }
+    Fragile::copies = 0;
+    Fragile::fail_at = 3;
+    EXPECT_THROW(v.emplace_back("e", Fragile(4)), std::runtime_error);
+    Fragile::fail_at = -1;
+    ASSERT_EQ(v.size(), 4U);
+    for (int i = 0; i < 4; ++i) {
+      EXPECT_EQ(std::get<0>(v[i]), std::string(20, static_cast<char>('a' + i)));
+      EXPECT_EQ(std::get<1>(v[i]).value, i);
+    }
+    EXPECT_EQ(Fragile::alive, 4);
+    v.emplace_back("e", Fragile(4));
+    EXPECT_EQ(std::get<0>(v[3]), std::string(20, 'd'));
+  }
+  EXPECT_EQ(Fragile::alive, 0);
+}
+
+TEST(SoaVector, ColumnsFeedSimdAndParallelAlgorithms) {
+  s21::soa_vector<std::int32_t, double> v;
+  for (std::int32_t i = 0; i < 5000; ++i) v.emplace_back(i % 100, i * 2.0);
+  EXPECT_EQ(s21::simd::count(v.column<0>(), 7), 50U);
+  EXPECT_EQ(s21::simd::accumulate(v.column<0>(), 0), 50 * 4950);
+  EXPECT_EQ(*s21::simd::max_element(v.column<0>()), 99);
+
+  s21::thread_pool pool(3);
+  auto xs = v.column<1>();
+  s21::parallel::transform(
+      pool, xs.begin(), xs.end(), xs.begin(), [](double x) { return x / 2; },
+      64);
+  EXPECT_DOUBLE_EQ(s21::parallel::reduce(pool, xs.begin(), xs.end(), 0.0),
+                   4999.0 * 5000 / 2);
+  auto ids = v.column<0>();
+  s21::parallel::sort(pool, ids.begin(), ids.end(), std::less<>(), 128);
+  EXPECT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+}
@@ -1,6 +1,10 @@
 #ifndef CPP2_S21_CONTAINERS_2_SRC_STACK_S21_STACK_H_
 #define CPP2_S21_CONTAINERS_2_SRC_STACK_S21_STACK_H_
 
+#include <memory>
+#include <type_traits>
+#include <utility>
+
 #include "../list/s21_list.h"
 
 namespace s21 {
@@ -15,6 +19,10 @@ class stack {
   using size_type = typename Container::size_type;
 
   stack() = default;
+  // Builds the underlying container with alloc, as std::stack does.
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  explicit stack(const Alloc &alloc) : stack_(alloc) {}
   stack(std::initializer_list<value_type> const &items) {
     for (auto &i : items) {
       push(i);
@@ -47,6 +55,13 @@ class stack {
 
   void push(const_reference value) { return stack_.push_front(value); }
 
+  void push(value_type &&value) { stack_.push_front(std::move(value)); }
+
+  template <class... Args>
+  void emplace(Args &&...args) {
+    stack_.emplace_front(std::forward<Args>(args)...);
+  }
+
   void pop() { return stack_.pop_front(); }
 
   void swap(stack &other) { return stack_.swap(other.stack_); }
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <memory>
 #include <stack>
+#include <string>
 #include <vector>
 
 #include "s21_stack.h"
@@ -165,4 +167,23 @@ TEST(StackTestOperatorMove, Test0) {
 
   ASSERT_EQ(stack1.top(), 3);
   ASSERT_EQ(stack3.top(), 3);
-}
\ No newline at end of file
+}
+
+TEST(StackAllocator, TakesTheUnderlyingList) {
+  s21::stack<int, s21::pooled_list<int>> stack0{1, 2, 3};
+  stack0.pop();
+  ASSERT_EQ(stack0.top(), 2);
+  ASSERT_EQ(stack0.size(), 2);
+}
+
+TEST(StackEmplace, EmplaceAndMove) {
+  s21::stack<std::string> stack0;
+  std::string payload(100, 'x');
+  const char *data = payload.data();
+  stack0.push(std::move(payload));
+  ASSERT_EQ(stack0.top().data(), data);
+  stack0.emplace(3, 'y');
+  ASSERT_EQ(stack0.top(), "yyy");
+  ASSERT_EQ(stack0.size(), 2);
+}
+
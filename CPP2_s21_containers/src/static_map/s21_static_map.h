@@ -0,0 +1,172 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_STATIC_MAP_S21_STATIC_MAP_H
+#define CPP2_S21_CONTAINERS_2_SRC_STATIC_MAP_S21_STATIC_MAP_H
+
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "../eytzinger/s21_eytzinger.h"
+#include "../map/s21_map.h"
+
+namespace s21 {
+
+// Read-only map frozen from an s21::map. Keys are searched in an Eytzinger
+// index; each value is stored at the same slot as its key in a second array,
+// so the search never drags values through the cache.
+template <typename Key, typename T>
+class static_map {
+ public:
+  class StaticMapIterator;
+
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = StaticMapIterator;
+  using const_iterator = StaticMapIterator;
+  using size_type = size_t;
+
+  static_map() : values_(nullptr) {}
+  static_map(std::initializer_list<value_type> const &items)
+      : static_map(map<Key, T>(items)) {}
+  template <typename Lookup>
+  explicit static_map(const map<Key, T, Lookup> &m)
+      : index_(KeyReader<Lookup>{m.begin()}, m.size()), values_(nullptr) {
+    if (index_.size() == 0) return;
+    values_ = allocate(index_.size());
+    auto it = m.begin();
+    for (size_type slot = index_.first(); slot != 0;
+         slot = index_.next(slot), ++it) {
+      new (values_ + slot) T((*it).second);
+    }
+  }
+  static_map(const static_map &m) : index_(m.index_), values_(nullptr) {
+    if (index_.size() == 0) return;
+    values_ = allocate(index_.size());
+    for (size_type slot = 1; slot <= index_.size(); ++slot) {
+      new (values_ + slot) T(m.values_[slot]);
+    }
+  }
+  static_map(static_map &&m)
+      : index_(std::move(m.index_)), values_(m.values_) {
+    m.values_ = nullptr;
+  }
+  ~static_map() { destroyValues(); }
+
+  static_map &operator=(static_map m) {
+    std::swap(index_, m.index_);
+    std::swap(values_, m.values_);
+    return *this;
+  }
+
+  const mapped_type &at(const Key &key) const {
+    size_type slot = index_.find(key);
+    if (slot == 0) {
+      throw std::out_of_range("Out of range. Index exceeds container bounds");
+    }
+    return values_[slot];
+  }
+
+  const_iterator begin() const {
+    return const_iterator(this, index_.first());
+  }
+  const_iterator end() const { return const_iterator(this, 0); }
+
+  bool empty() const { return index_.size() == 0; }
+  size_type size() const { return index_.size(); }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() /
+           (sizeof(key_type) + sizeof(mapped_type));
+  }
+
+  const_iterator find(const Key &key) const {
+    return const_iterator(this, index_.find(key));
+  }
+  const_iterator lower_bound(const Key &key) const {
+    return const_iterator(this, index_.lowerBound(key));
+  }
+  bool contains(const Key &key) const { return index_.find(key) != 0; }
+
+  // Answers contains() for count keys, interleaving the searches.
+  void contains_many(const Key *keys, size_type count, bool *result) const {
+    size_type slots[kChunk];
+    for (size_type base = 0; base < count; base += kChunk) {
+      size_type part = count - base < kChunk ? count - base : kChunk;
+      index_.findMany(keys + base, part, slots);
+      for (size_type i = 0; i < part; ++i) result[base + i] = slots[i] != 0;
+    }
+  }
+
+  // Dereferencing yields the element by value, like s21::map's iterator.
+  class StaticMapIterator {
+   public:
+    StaticMapIterator() : map_(nullptr), slot_(0) {}
+    StaticMapIterator(const static_map *map, size_type slot)
+        : map_(map), slot_(slot) {}
+
+    value_type operator*() const {
+      return value_type(map_->index_.key(slot_), map_->values_[slot_]);
+    }
+
+    StaticMapIterator &operator++() {
+      slot_ = map_->index_.next(slot_);
+      return *this;
+    }
+
+    StaticMapIterator operator++(int) {
+      StaticMapIterator temp = *this;
+      ++*this;
+      return temp;
+    }
+
+    bool operator==(const StaticMapIterator &other) const {
+      return slot_ == other.slot_;
+    }
+
+    bool operator!=(const StaticMapIterator &other) const {
+      return slot_ != other.slot_;
+    }
+
+   private:
+    const static_map *map_;
+    size_type slot_;
+  };
+
+ private:
+  static constexpr size_type kChunk = 256;
+
+  // Walks a map's elements yielding only their keys.
+  template <typename Lookup>
+  struct KeyReader {
+    typename map<Key, T, Lookup>::const_iterator it;
+
+    Key operator*() const { return (*it).first; }
+    KeyReader &operator++() {
+      ++it;
+      return *this;
+    }
+  };
+
+  static T *allocate(size_type size) {
+    return static_cast<T *>(::operator new((size + 1) * sizeof(T)));
+  }
+
+  void destroyValues() {
+    if (values_ == nullptr) return;
+    for (size_type slot = 1; slot <= index_.size(); ++slot) {
+      values_[slot].~T();
+    }
+    ::operator delete(values_);
+    values_ = nullptr;
+  }
+
+  EytzingerIndex<Key> index_;
+  T *values_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_STATIC_MAP_S21_STATIC_MAP_H
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+#include "s21_static_map.h"
+
+TEST(static_map, ConstructorDefault) {
+  s21::static_map<int, int> my_map;
+  EXPECT_TRUE(my_map.empty());
+  EXPECT_FALSE(my_map.contains(1));
+  EXPECT_THROW(my_map.at(1), std::out_of_range);
+}
+
+TEST(static_map, FrozenFromMap) {
+  s21::map<int, std::string> source = {{3, "three"}, {1, "one"}, {2, "two"}};
+  s21::static_map<int, std::string> my_map(source);
+  std::map<int, std::string> map = {{3, "three"}, {1, "one"}, {2, "two"}};
+  EXPECT_EQ(my_map.size(), map.size());
+  EXPECT_EQ(my_map.at(2), "two");
+  EXPECT_THROW(my_map.at(4), std::out_of_range);
+  auto it = map.begin();
+  for (auto my_it = my_map.begin(); my_it != my_map.end(); ++my_it, ++it) {
+    EXPECT_EQ((*my_it).first, it->first);
+    EXPECT_EQ((*my_it).second, it->second);
+  }
+}
+
+TEST(static_map, FindAndContainsMany) {
+  s21::static_map<int, int> my_map = {{2, 20}, {4, 40}, {6, 60}};
+  EXPECT_EQ((*my_map.find(4)).second, 40);
+  EXPECT_TRUE(my_map.find(5) == my_map.end());
+  EXPECT_EQ((*my_map.lower_bound(5)).first, 6);
+  int keys[] = {1, 2, 3, 4, 5, 6, 7};
+  bool result[7];
+  my_map.contains_many(keys, 7, result);
+  for (int i = 0; i < 7; ++i) {
+    EXPECT_EQ(result[i], keys[i] % 2 == 0 && keys[i] < 7);
+  }
+}
+
+TEST(static_map, CopyAndAssign) {
+  s21::static_map<int, std::string> my_map = {{1, "a"}, {2, "b"}};
+  s21::static_map<int, std::string> copy(my_map);
+  s21::static_map<int, std::string> other;
+  other = my_map;
+  my_map = s21::static_map<int, std::string>();
+  EXPECT_TRUE(my_map.empty());
+  EXPECT_EQ(copy.at(1), "a");
+  EXPECT_EQ(other.at(2), "b");
+}
@@ -0,0 +1,110 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_STATIC_SET_S21_STATIC_SET_H
+#define CPP2_S21_CONTAINERS_2_SRC_STATIC_SET_S21_STATIC_SET_H
+
+#include <initializer_list>
+#include <limits>
+
+#include "../eytzinger/s21_eytzinger.h"
+#include "../set/s21_set.h"
+
+namespace s21 {
+
+// Read-only set frozen from an s21::set. Keys sit in one cache-aligned array
+// in Eytzinger order, which suits programs that build a set once and then
+// only test membership.
+template <typename Key>
+class static_set {
+ public:
+  class StaticSetIterator;
+
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = StaticSetIterator;
+  using const_iterator = StaticSetIterator;
+  using size_type = size_t;
+
+  static_set() = default;
+  static_set(std::initializer_list<value_type> const &items)
+      : static_set(set<Key>(items)) {}
+  template <typename Lookup>
+  explicit static_set(const set<Key, Lookup> &s)
+      : index_(s.begin(), s.size()) {}
+  static_set(const static_set &s) = default;
+  static_set(static_set &&s) = default;
+  ~static_set() = default;
+
+  static_set &operator=(const static_set &s) = default;
+  static_set &operator=(static_set &&s) = default;
+
+  const_iterator begin() const {
+    return const_iterator(&index_, index_.first());
+  }
+  const_iterator end() const { return const_iterator(&index_, 0); }
+
+  bool empty() const { return index_.size() == 0; }
+  size_type size() const { return index_.size(); }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  const_iterator find(const Key &key) const {
+    return const_iterator(&index_, index_.find(key));
+  }
+  const_iterator lower_bound(const Key &key) const {
+    return const_iterator(&index_, index_.lowerBound(key));
+  }
+  bool contains(const Key &key) const { return index_.find(key) != 0; }
+
+  // Answers contains() for count keys, interleaving the searches.
+  void contains_many(const Key *keys, size_type count, bool *result) const {
+    size_type slots[kChunk];
+    for (size_type base = 0; base < count; base += kChunk) {
+      size_type part = count - base < kChunk ? count - base : kChunk;
+      index_.findMany(keys + base, part, slots);
+      for (size_type i = 0; i < part; ++i) result[base + i] = slots[i] != 0;
+    }
+  }
+
+  class StaticSetIterator {
+   public:
+    StaticSetIterator() : index_(nullptr), slot_(0) {}
+    StaticSetIterator(const EytzingerIndex<Key> *index, size_type slot)
+        : index_(index), slot_(slot) {}
+
+    const_reference operator*() const { return index_->key(slot_); }
+
+    StaticSetIterator &operator++() {
+      slot_ = index_->next(slot_);
+      return *this;
+    }
+
+    StaticSetIterator operator++(int) {
+      StaticSetIterator temp = *this;
+      ++*this;
+      return temp;
+    }
+
+    bool operator==(const StaticSetIterator &other) const {
+      return slot_ == other.slot_;
+    }
+
+    bool operator!=(const StaticSetIterator &other) const {
+      return slot_ != other.slot_;
+    }
+
+   private:
+    const EytzingerIndex<Key> *index_;
+    size_type slot_;
+  };
+
+ private:
+  static constexpr size_type kChunk = 256;
+
+  EytzingerIndex<Key> index_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_STATIC_SET_S21_STATIC_SET_H
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "s21_static_set.h"
+
+TEST(static_set, ConstructorDefault) {
+  s21::static_set<int> my_set;
+  EXPECT_TRUE(my_set.empty());
+  EXPECT_EQ(my_set.size(), 0U);
+  EXPECT_FALSE(my_set.contains(0));
+  EXPECT_TRUE(my_set.begin() == my_set.end());
+}
+
+TEST(static_set, FrozenFromSet) {
+  s21::set<int> source = {5, 1, 9, 3, 7};
+  s21::static_set<int> my_set(source);
+  EXPECT_EQ(my_set.size(), 5U);
+  for (int key = 0; key <= 10; ++key) {
+    EXPECT_EQ(my_set.contains(key), source.contains(key));
+  }
+}
+
+TEST(static_set, IteratesInOrder) {
+  for (int count = 0; count < 70; ++count) {
+    s21::set<int> source;
+    std::set<int> set;
+    for (int i = 0; i < count; ++i) {
+      source.insert(i * 3);
+      set.insert(i * 3);
+    }
+    s21::static_set<int> my_set(source);
+    auto it = set.begin();
+    for (auto my_it = my_set.begin(); my_it != my_set.end(); ++my_it, ++it) {
+      ASSERT_EQ(*my_it, *it);
+    }
+    EXPECT_TRUE(it == set.end());
+  }
+}
+
+TEST(static_set, FindAndLowerBound) {
+  const s21::static_set<int> my_set = {10, 20, 30, 40};
+  EXPECT_EQ(*my_set.find(30), 30);
+  EXPECT_TRUE(my_set.find(35) == my_set.end());
+  EXPECT_EQ(*my_set.lower_bound(5), 10);
+  EXPECT_EQ(*my_set.lower_bound(21), 30);
+  EXPECT_EQ(*my_set.lower_bound(40), 40);
+  EXPECT_TRUE(my_set.lower_bound(41) == my_set.end());
+}
+
+TEST(static_set, ContainsManyMatchesContains) {
+  s21::set<std::uint64_t> source;
+  for (std::uint64_t i = 0; i < 1000; ++i) source.insert(i * i);
+  s21::static_set<std::uint64_t> my_set(source);
+  std::vector<std::uint64_t> keys;
+  for (std::uint64_t i = 0; i < 3000; ++i) keys.push_back(i * 7);
+  std::vector<char> expected;
+  for (auto key : keys) expected.push_back(my_set.contains(key));
+
+  bool result[3000];
+  my_set.contains_many(keys.data(), keys.size(), result);
+  for (size_t i = 0; i < keys.size(); ++i) EXPECT_EQ(result[i], expected[i]);
+}
+
+TEST(static_set, CopyAndMove) {
+  s21::static_set<int> my_set = {1, 2, 3};
+  s21::static_set<int> copy = my_set;
+  s21::static_set<int> moved(std::move(my_set));
+  EXPECT_TRUE(copy.contains(2));
+  EXPECT_TRUE(moved.contains(3));
+  EXPECT_EQ(moved.size(), 3U);
+  copy = moved;
+  EXPECT_EQ(copy.size(), 3U);
+}
@@ -0,0 +1,243 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_THREAD_POOL_S21_PARALLEL_H
+#define CPP2_S21_CONTAINERS_2_SRC_THREAD_POOL_S21_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+// Parallel versions of the std algorithms over random-access ranges such as
+// s21::vector and s21::array. The range is cut into blocks of `grain`
+// elements that run serially on whichever pool thread picks them up; 0
+// picks a grain that gives each thread about eight blocks but never fewer
+// than 1024 elements. Functors are shared between threads and must be safe
+// to call concurrently; reduce() and inclusive_scan() need an associative
+// op. sort() and stable_sort() merge through a temporary buffer, so the
+// element type must be default-constructible.
+namespace parallel {
+
+inline std::size_t grainFor(const thread_pool &pool, std::size_t n,
+                            std::size_t grain) {
+  if (grain != 0) return grain;
+  return std::max<std::size_t>(n / (8 * pool.size()), 1024);
+}
+
+// Calls body(begin, end) for blocks [lo, hi) of [0, n), each grain long.
+template <typename Body>
+void forBlocks(thread_pool &pool, std::size_t n, std::size_t grain,
+               std::size_t lo, std::size_t hi, const Body &body) {
+  if (hi - lo == 1) {
+    body(lo * grain, std::min(n, hi * grain));
+    return;
+  }
+  std::size_t mid = lo + (hi - lo) / 2;
+  pool.invoke([&] { forBlocks(pool, n, grain, lo, mid, body); },
+              [&] { forBlocks(pool, n, grain, mid, hi, body); });
+}
+
+template <typename Body>
+void forRange(thread_pool &pool, std::size_t n, std::size_t grain,
+              const Body &body) {
+  if (n == 0) return;
+  forBlocks(pool, n, grain, 0, (n + grain - 1) / grain, body);
+}
+
+template <typename It, typename F>
+void for_each(thread_pool &pool, It first, It last, F f,
+              std::size_t grain = 0) {
+  std::size_t n = last - first;
+  forRange(pool, n, grainFor(pool, n, grain),
+           [&](std::size_t begin, std::size_t end) {
+             for (It it = first + begin; it != first + end; ++it) f(*it);
+           });
+}
+
+template <typename It, typename OutIt, typename UnaryOp>
+OutIt transform(thread_pool &pool, It first, It last, OutIt d_first,
+                UnaryOp op, std::size_t grain = 0) {
+  std::size_t n = last - first;
+  forRange(pool, n, grainFor(pool, n, grain),
+           [&](std::size_t begin, std::size_t end) {
+             std::transform(first + begin, first + end, d_first + begin, op);
+           });
+  return d_first + n;
+}
+
+template <typename It, typename T, typename BinaryOp>
+T reduceBlocks(thread_pool &pool, It first, std::size_t n, std::size_t grain,
+               std::size_t lo, std::size_t hi, const BinaryOp &op) {
+  if (hi - lo == 1) {
+    It it = first + lo * grain;
+    It end = first + std::min(n, hi * grain);
+    T acc = *it;
+    while (++it != end) acc = op(std::move(acc), *it);
+    return acc;
+  }
+  std::size_t mid = lo + (hi - lo) / 2;
+  std::optional<T> left;
+  std::optional<T> right;
+  pool.invoke(
+      [&] { left.emplace(reduceBlocks<It, T>(pool, first, n, grain, lo, mid,
+                                             op)); },
+      [&] { right.emplace(reduceBlocks<It, T>(pool, first, n, grain, mid, hi,
+                                              op)); });
+  return op(std::move(*left), std::move(*right));
+}
+
+// Blocks are folded in order, but the grouping of the partial results
+// depends on the grain, so a non-associative op gives unspecified results.
+template <typename It, typename T, typename BinaryOp>
+T reduce(thread_pool &pool, It first, It last, T init, BinaryOp op,
+         std::size_t grain = 0) {
+  std::size_t n = last - first;
+  if (n == 0) return init;
+  std::size_t g = grainFor(pool, n, grain);
+  return op(std::move(init), reduceBlocks<It, T>(pool, first, n, g, 0,
+                                                 (n + g - 1) / g, op));
+}
+
+template <typename It, typename T>
+T reduce(thread_pool &pool, It first, It last, T init) {
+  return parallel::reduce(pool, first, last, std::move(init), std::plus<>());
+}
+
+// Scans every block on its own, carries the block totals across serially,
+// then adds each carry to the following block. d_first may equal first.
+template <typename It, typename OutIt, typename BinaryOp>
+OutIt inclusive_scan(thread_pool &pool, It first, It last, OutIt d_first,
+                     BinaryOp op, std::size_t grain = 0) {
+  using value_type = typename std::iterator_traits<It>::value_type;
+  std::size_t n = last - first;
+  std::size_t g = grainFor(pool, n, grain);
+  forRange(pool, n, g, [&](std::size_t begin, std::size_t end) {
+    std::partial_sum(first + begin, first + end, d_first + begin, op);
+  });
+  if (n <= g) return d_first + n;
+
+  s21::vector<value_type> carries;
+  carries.push_back(d_first[g - 1]);
+  for (std::size_t end = 2 * g; end < n; end += g) {
+    carries.push_back(op(carries.back(), d_first[end - 1]));
+  }
+  forRange(pool, n - g, g, [&](std::size_t begin, std::size_t end) {
+    const value_type &carry = carries[begin / g];
+    for (std::size_t i = g + begin; i < g + end; ++i) {
+      d_first[i] = op(carry, d_first[i]);
+    }
+  });
+  return d_first + n;
+}
+
+template <typename It, typename OutIt>
+OutIt inclusive_scan(thread_pool &pool, It first, It last, OutIt d_first) {
+  return parallel::inclusive_scan(pool, first, last, d_first, std::plus<>());
+}
+
+// Stable merge of [a, a + na) and [b, b + nb) into out. The longer run is
+// split at its middle and the other at the matching bound, so equal
+// elements from a stay ahead of those from b.
+template <typename In, typename Out, typename Compare>
+void mergeInto(thread_pool &pool, In a, std::size_t na, In b, std::size_t nb,
+               Out out, std::size_t grain, const Compare &comp) {
+  if (na + nb <= std::max<std::size_t>(grain, 2)) {
+    std::merge(std::make_move_iterator(a), std::make_move_iterator(a + na),
+               std::make_move_iterator(b), std::make_move_iterator(b + nb),
+               out, comp);
+    return;
+  }
+  std::size_t ma = 0;
+  std::size_t mb = 0;
+  if (na >= nb) {
+    ma = na / 2;
+    mb = std::lower_bound(b, b + nb, a[ma], comp) - b;
+  } else {
+    mb = nb / 2;
+    ma = std::upper_bound(a, a + na, b[mb], comp) - a;
+  }
+  pool.invoke(
+      [&] { mergeInto(pool, a, ma, b, mb, out, grain, comp); },
+      [&] {
+        mergeInto(pool, a + ma, na - ma, b + mb, nb - mb, out + ma + mb,
+                  grain, comp);
+      });
+}
+
+// Sorts [lo, hi) of data, leaving the result in buffer when into_buffer is
+// set. The halves are sorted into the opposite array and merged back, so
+// each level moves every element once.
+template <typename It, typename T, typename Compare>
+void mergeSort(thread_pool &pool, It data, T *buffer, std::size_t lo,
+               std::size_t hi, bool into_buffer, std::size_t grain,
+               const Compare &comp, bool stable) {
+  if (hi - lo <= grain) {
+    if (stable) {
+      std::stable_sort(data + lo, data + hi, comp);
+    } else {
+      std::sort(data + lo, data + hi, comp);
+    }
+    if (into_buffer) {
+      std::move(data + lo, data + hi, buffer + lo);
+    }
+    return;
+  }
+  std::size_t mid = lo + (hi - lo) / 2;
+  pool.invoke(
+      [&] {
+        mergeSort(pool, data, buffer, lo, mid, !into_buffer, grain, comp,
+                  stable);
+      },
+      [&] {
+        mergeSort(pool, data, buffer, mid, hi, !into_buffer, grain, comp,
+                  stable);
+      });
+  if (into_buffer) {
+    mergeInto(pool, data + lo, mid - lo, data + mid, hi - mid, buffer + lo,
+              grain, comp);
+  } else {
+    mergeInto(pool, buffer + lo, mid - lo, buffer + mid, hi - mid, data + lo,
+              grain, comp);
+  }
+}
+
+template <typename It, typename Compare>
+void sortRange(thread_pool &pool, It first, It last, const Compare &comp,
+               std::size_t grain, bool stable) {
+  using value_type = typename std::iterator_traits<It>::value_type;
+  std::size_t n = last - first;
+  std::size_t g = grainFor(pool, n, grain);
+  if (n <= g || pool.size() == 1) {
+    if (stable) {
+      std::stable_sort(first, last, comp);
+    } else {
+      std::sort(first, last, comp);
+    }
+    return;
+  }
+  s21::vector<value_type> buffer(n);
+  mergeSort(pool, first, buffer.data(), 0, n, false, g, comp, stable);
+}
+
+template <typename It, typename Compare = std::less<>>
+void sort(thread_pool &pool, It first, It last, Compare comp = Compare(),
+          std::size_t grain = 0) {
+  sortRange(pool, first, last, comp, grain, false);
+}
+
+template <typename It, typename Compare = std::less<>>
+void stable_sort(thread_pool &pool, It first, It last,
+                 Compare comp = Compare(), std::size_t grain = 0) {
+  sortRange(pool, first, last, comp, grain, true);
+}
+
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_THREAD_POOL_S21_PARALLEL_H
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../array/s21_array.h"
+#include "../vector/s21_vector.h"
+#include "s21_parallel.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+s21::vector<int> randomInts(std::size_t n, int range, unsigned seed) {
+  std::mt19937 random(seed);
+  s21::vector<int> data;
+  for (std::size_t i = 0; i < n; ++i) {
+    data.push_back(static_cast<int>(random() % range));
+  }
+  return data;
+}
+
+long fib(s21::thread_pool &pool, int n) {
+  if (n < 2) return n;
+  long a = 0;
+  long b = 0;
+  pool.invoke([&] { a = fib(pool, n - 1); }, [&] { b = fib(pool, n - 2); });
+  return a + b;
+}
+
+}  // namespace
+
+TEST(ThreadPool, SizeCountsTheCaller) {
+  s21::thread_pool one(1);
+  s21::thread_pool four(4);
+  EXPECT_EQ(one.size(), 1U);
+  EXPECT_EQ(four.size(), 4U);
+  EXPECT_GE(s21::thread_pool::instance().size(), 1U);
+}
+
+TEST(ThreadPool, InvokeRunsBothBranches) {
+  for (std::size_t threads : {1, 2, 4}) {
+    s21::thread_pool pool(threads);
+    int a = 0;
+    int b = 0;
+    pool.invoke([&] { a = 1; }, [&] { b = 2; });
+    EXPECT_EQ(a + b, 3);
+  }
+}
+
+TEST(ThreadPool, NestedInvokeCompletes) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(fib(pool, 20), 6765);
+}
+
+TEST(ThreadPool, ExceptionsReachTheCaller) {
+  s21::thread_pool pool(3);
+  std::atomic<int> runs(0);
+  EXPECT_THROW(pool.invoke([&] { ++runs; },
+                           [] { throw std::runtime_error("second"); }),
+               std::runtime_error);
+  EXPECT_THROW(pool.invoke([] { throw std::logic_error("first"); },
+                           [&] { ++runs; }),
+               std::logic_error);
+  EXPECT_EQ(fib(pool, 10), 55);
+  EXPECT_GE(runs.load(), 1);
+}
+
+TEST(ThreadPool, ExternalThreadsShareThePool) {
+  s21::thread_pool pool(2);
+  std::atomic<long> total(0);
+  std::vector<std::thread> callers;
+  for (int t = 0; t < 3; ++t) {
+    callers.emplace_back([&] { total += fib(pool, 15); });
+  }
+  for (std::thread &caller : callers) caller.join();
+  EXPECT_EQ(total.load(), 3 * 610);
+}
+
+TEST(Parallel, ForEachAndTransform) {
+  s21::thread_pool pool(4);
+  s21::vector<int> v = randomInts(5000, 100, 1);
+  s21::vector<int> expected = v;
+  for (int &x : expected) x *= 3;
+  s21::parallel::for_each(
+      pool, v.begin(), v.end(), [](int &x) { x *= 3; }, 7);
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+
+  s21::vector<long> out(v.size());
+  auto last = s21::parallel::transform(
+      pool, v.begin(), v.end(), out.begin(),
+      [](int x) { return static_cast<long>(x) + 1; }, 13);
+  EXPECT_EQ(last, out.end());
+  for (std::size_t i = 0; i < v.size(); ++i) EXPECT_EQ(out[i], v[i] + 1);
+}
+
+TEST(Parallel, ReduceMatchesAccumulate) {
+  s21::thread_pool pool(4);
+  for (std::size_t n : {0, 1, 2, 63, 1000, 4097}) {
+    s21::vector<int> v = randomInts(n, 1000, 2);
+    long expected = std::accumulate(v.begin(), v.end(), 10L);
+    for (std::size_t grain : {1, 5, 64, 0}) {
+      EXPECT_EQ(s21::parallel::reduce(pool, v.begin(), v.end(), 10L,
+                                      std::plus<>(), grain),
+                expected);
+    }
+    EXPECT_EQ(s21::parallel::reduce(pool, v.begin(), v.end(), 10L), expected);
+  }
+}
+
+TEST(Parallel, ReduceKeepsOrderForAssociativeOps) {
+  s21::thread_pool pool(4);
+  s21::vector<std::string> words;
+  for (int i = 0; i < 300; ++i) words.push_back(std::string(1, 'a' + i % 26));
+  std::string expected =
+      std::accumulate(words.begin(), words.end(), std::string(">"));
+  EXPECT_EQ(s21::parallel::reduce(pool, words.begin(), words.end(),
+                                  std::string(">"), std::plus<>(), 7),
+            expected);
+}
+
+TEST(Parallel, InclusiveScanMatchesPartialSum) {
+  s21::thread_pool pool(4);
+  for (std::size_t n : {0, 1, 9, 100, 3001}) {
+    s21::vector<int> v = randomInts(n, 50, 3);
+    s21::vector<int> expected(n);
+    std::partial_sum(v.begin(), v.end(), expected.begin());
+    for (std::size_t grain : {1, 4, 10, 0}) {
+      s21::vector<int> out(n);
+      EXPECT_EQ(s21::parallel::inclusive_scan(pool, v.begin(), v.end(),
+                                              out.begin(), std::plus<>(),
+                                              grain),
+                out.end());
+      EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+    }
+    s21::parallel::inclusive_scan(pool, v.begin(), v.end(), v.begin());
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  }
+}
+
+TEST(Parallel, SortMatchesStd) {
+  for (std::size_t threads : {1, 4}) {
+    s21::thread_pool pool(threads);
+    for (std::size_t n : {0, 1, 2, 3, 17, 1000, 20000}) {
+      for (std::size_t grain : {1, 16, 0}) {
+        s21::vector<int> v = randomInts(n, 500, 4);
+        s21::vector<int> expected = v;
+        std::sort(expected.begin(), expected.end(), std::greater<>());
+        s21::parallel::sort(pool, v.begin(), v.end(), std::greater<>(),
+                            grain);
+        EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+      }
+    }
+  }
+}
+
+TEST(Parallel, StableSortKeepsEqualKeysInOrder) {
+  s21::thread_pool pool(4);
+  std::mt19937 random(5);
+  s21::vector<std::pair<int, int>> v;
+  for (int i = 0; i < 5000; ++i) {
+    v.push_back({static_cast<int>(random() % 20), i});
+  }
+  auto byKey = [](const std::pair<int, int> &a,
+                  const std::pair<int, int> &b) { return a.first < b.first; };
+  s21::vector<std::pair<int, int>> expected = v;
+  std::stable_sort(expected.begin(), expected.end(), byKey);
+  for (std::size_t grain : {1, 33, 0}) {
+    s21::vector<std::pair<int, int>> copy = v;
+    s21::parallel::stable_sort(pool, copy.begin(), copy.end(), byKey, grain);
+    EXPECT_TRUE(std::equal(copy.begin(), copy.end(), expected.begin()));
+  }
+}
+
+TEST(Parallel, WorksOnS21Array) {
+  s21::thread_pool pool(3);
+  s21::array<int, 500> a;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    a[i] = static_cast<int>((i * 7919) % 500);
+  }
+  s21::parallel::sort(pool, a.begin(), a.end(), std::less<>(), 8);
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    EXPECT_EQ(a[i], static_cast<int>(i));
+  }
+  EXPECT_EQ(s21::parallel::reduce(pool, a.begin(), a.end(), 0), 499 * 250);
+}
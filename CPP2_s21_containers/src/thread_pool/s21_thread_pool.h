@@ -0,0 +1,221 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_THREAD_POOL_S21_THREAD_POOL_H
+#define CPP2_S21_CONTAINERS_2_SRC_THREAD_POOL_S21_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Fork-join pool with one deque per worker. A thread that forks pushes the
+// second branch onto the back of its own deque, runs the first branch, then
+// pops the second back unless another worker has stolen it from the front.
+// While it waits for a stolen branch it runs other queued jobs instead of
+// blocking, so nested invoke() never deadlocks.
+//
+// thread_pool(n) runs work on n threads: the caller of invoke() plus n - 1
+// workers. Threads outside the pool share an extra deque that workers steal
+// from. Each deque has its own mutex; jobs live on the forking thread's
+// stack, so forking allocates nothing.
+class thread_pool {
+ public:
+  explicit thread_pool(std::size_t threads = defaultThreads())
+      : queues_(threads == 0 ? 1 : threads),
+        workers_(queues_.size() - 1),
+        stop_(false),
+        pending_(0),
+        sleepers_(0) {
+    for (std::size_t i = 0; i < workers_.size(); ++i) {
+      workers_[i] = std::thread([this, i] { workerLoop(i); });
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  ~thread_pool() {
+    stop_.store(true);
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+    }
+    wake_.notify_all();
+    for (std::thread &worker : workers_) worker.join();
+  }
+
+  // Threads that take part in the work, counting the caller.
+  std::size_t size() const { return workers_.size() + 1; }
+
+  // Runs a() and b(), possibly in parallel, and returns once both are done.
+  // An exception from either is rethrown here once neither is running; b()
+  // is skipped if a() throws before anyone has picked it up.
+  template <typename A, typename B>
+  void invoke(A &&a, B &&b) {
+    if (workers_.empty()) {
+      a();
+      b();
+      return;
+    }
+    FnJob<std::remove_reference_t<B>> job(b);
+    Queue &queue = queues_[currentIndex()];
+    push(queue, &job);
+    std::exception_ptr error;
+    try {
+      a();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    if (popBack(queue, &job)) {
+      pending_.fetch_sub(1);
+      if (!error) job.run(&job);
+    } else {
+      while (!job.done.load(std::memory_order_acquire)) {
+        if (!runOne(currentIndex())) std::this_thread::yield();
+      }
+    }
+    if (error) std::rethrow_exception(error);
+    if (job.error) std::rethrow_exception(job.error);
+  }
+
+  // Shared pool with one thread per core, created on first use.
+  static thread_pool &instance() {
+    static thread_pool pool;
+    return pool;
+  }
+
+ private:
+  struct Job {
+    void (*run)(Job *);
+    std::atomic<bool> done{false};
+    std::exception_ptr error;
+  };
+
+  template <typename F>
+  struct FnJob : Job {
+    explicit FnJob(F &f) : fn(&f) { this->run = &call; }
+
+    static void call(Job *job) {
+      FnJob *self = static_cast<FnJob *>(job);
+      try {
+        (*self->fn)();
+      } catch (...) {
+        self->error = std::current_exception();
+      }
+      self->done.store(true, std::memory_order_release);
+    }
+
+    F *fn;
+  };
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Job *> jobs;
+  };
+
+  static constexpr int kSpins = 64;
+
+  static std::size_t defaultThreads() {
+    unsigned n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : n;
+  }
+
+  // Worker index of the calling thread in this pool, or the shared deque.
+  std::size_t currentIndex() const {
+    if (current_pool_ == this) return current_index_;
+    return queues_.size() - 1;
+  }
+
+  void push(Queue &queue, Job *job) {
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.jobs.push_back(job);
+    }
+    pending_.fetch_add(1);
+    if (sleepers_.load() > 0) {
+      {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+      }
+      wake_.notify_one();
+    }
+  }
+
+  // Takes job back if it is still the newest entry of queue.
+  static bool popBack(Queue &queue, Job *job) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty() || queue.jobs.back() != job) return false;
+    queue.jobs.pop_back();
+    return true;
+  }
+
+  Job *take(std::size_t self) {
+    if (pending_.load() == 0) return nullptr;
+    {
+      Queue &own = queues_[self];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      if (!own.jobs.empty()) {
+        Job *job = own.jobs.back();
+        own.jobs.pop_back();
+        return job;
+      }
+    }
+    for (std::size_t i = 1; i < queues_.size(); ++i) {
+      Queue &victim = queues_[(self + i) % queues_.size()];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.jobs.empty()) {
+        Job *job = victim.jobs.front();
+        victim.jobs.pop_front();
+        return job;
+      }
+    }
+    return nullptr;
+  }
+
+  bool runOne(std::size_t self) {
+    Job *job = take(self);
+    if (job == nullptr) return false;
+    pending_.fetch_sub(1);
+    job->run(job);
+    return true;
+  }
+
+  void workerLoop(std::size_t index) {
+    current_pool_ = this;
+    current_index_ = index;
+    int idle = 0;
+    while (!stop_.load()) {
+      if (runOne(index)) {
+        idle = 0;
+      } else if (++idle < kSpins) {
+        std::this_thread::yield();
+      } else {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        sleepers_.fetch_add(1);
+        wake_.wait(lock, [this] { return stop_.load() || pending_.load(); });
+        sleepers_.fetch_sub(1);
+        idle = 0;
+      }
+    }
+  }
+
+  s21::vector<Queue> queues_;
+  s21::vector<std::thread> workers_;
+  std::atomic<bool> stop_;
+  std::atomic<std::size_t> pending_;
+  std::atomic<std::size_t> sleepers_;
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+
+  static inline thread_local const thread_pool *current_pool_ = nullptr;
+  static inline thread_local std::size_t current_index_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_THREAD_POOL_S21_THREAD_POOL_H
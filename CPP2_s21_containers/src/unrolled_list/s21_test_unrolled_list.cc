@@ -0,0 +1,277 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <string>
+
+#include "../list/s21_list.h"
+#include "s21_unrolled_list.h"
+
+namespace {
+
+using small_list = s21::unrolled_list<int, 4>;
+
+template <typename List, typename T>
+void expectSameContents(const List &my_list, const std::list<T> &list) {
+  EXPECT_EQ(my_list.size(), list.size());
+  auto it = list.begin();
+  for (auto my_it = my_list.begin(); my_it != my_list.end(); ++my_it, ++it) {
+    ASSERT_TRUE(it != list.end());
+    EXPECT_EQ(*my_it, *it);
+  }
+  EXPECT_TRUE(it == list.end());
+}
+
+}  // namespace
+
+TEST(unrolled_list, ConstructorDefault) {
+  s21::unrolled_list<int> my_list;
+  EXPECT_TRUE(my_list.empty());
+  EXPECT_EQ(my_list.size(), 0U);
+  EXPECT_TRUE(my_list.begin() == my_list.end());
+  EXPECT_THROW(my_list.front(), std::out_of_range);
+  EXPECT_THROW(my_list.back(), std::out_of_range);
+}
+
+TEST(unrolled_list, ConstructorSizeAndList) {
+  small_list sized(10);
+  expectSameContents(sized, std::list<int>(10));
+  small_list items{1, 2, 3, 4, 5, 6, 7};
+  expectSameContents(items, std::list<int>{1, 2, 3, 4, 5, 6, 7});
+  EXPECT_EQ(items.front(), 1);
+  EXPECT_EQ(items.back(), 7);
+}
+
+TEST(unrolled_list, CopyAndMove) {
+  small_list items{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  small_list copy(items);
+  EXPECT_TRUE(copy == items);
+  small_list moved(std::move(copy));
+  EXPECT_TRUE(moved == items);
+  EXPECT_TRUE(copy.empty());
+  copy = moved;
+  EXPECT_TRUE(copy == items);
+  small_list assigned;
+  assigned = std::move(moved);
+  EXPECT_TRUE(assigned == items);
+  EXPECT_TRUE(moved.empty());
+  assigned = {3, 2, 1};
+  expectSameContents(assigned, std::list<int>{3, 2, 1});
+  EXPECT_TRUE(assigned != items);
+}
+
+TEST(unrolled_list, PushAndPopBothEnds) {
+  small_list my_list;
+  std::list<int> list;
+  for (int i = 0; i < 50; ++i) {
+    my_list.push_back(i);
+    list.push_back(i);
+    my_list.push_front(-i);
+    list.push_front(-i);
+  }
+  expectSameContents(my_list, list);
+  for (int i = 0; i < 30; ++i) {
+    my_list.pop_back();
+    list.pop_back();
+    my_list.pop_front();
+    list.pop_front();
+  }
+  expectSameContents(my_list, list);
+  while (!list.empty()) {
+    my_list.pop_front();
+    list.pop_front();
+  }
+  EXPECT_TRUE(my_list.empty());
+  EXPECT_TRUE(my_list.begin() == my_list.end());
+}
+
+TEST(unrolled_list, InsertSplitsFullChunks) {
+  small_list my_list{1, 2, 3, 4};
+  std::list<int> list{1, 2, 3, 4};
+  auto it = my_list.insert(++my_list.begin(), 10);
+  list.insert(++list.begin(), 10);
+  EXPECT_EQ(*it, 10);
+  it = my_list.insert(my_list.end(), 20);
+  list.insert(list.end(), 20);
+  EXPECT_EQ(*it, 20);
+  it = my_list.insert(my_list.begin(), 30);
+  list.insert(list.begin(), 30);
+  EXPECT_EQ(*it, 30);
+  expectSameContents(my_list, list);
+}
+
+TEST(unrolled_list, EraseReturnsNextAndRepacks) {
+  small_list my_list;
+  std::list<int> list;
+  for (int i = 0; i < 40; ++i) {
+    my_list.push_back(i);
+    list.push_back(i);
+  }
+  auto my_it = my_list.begin();
+  auto it = list.begin();
+  while (it != list.end()) {
+    if (*it % 3 != 0) {
+      my_it = my_list.erase(my_it);
+      it = list.erase(it);
+      ASSERT_TRUE((my_it == my_list.end()) == (it == list.end()));
+      if (it != list.end()) {
+        EXPECT_EQ(*my_it, *it);
+      }
+    } else {
+      ++my_it;
+      ++it;
+    }
+  }
+  expectSameContents(my_list, list);
+  EXPECT_TRUE(my_list.erase(my_list.end()) == my_list.end());
+}
+
+TEST(unrolled_list, IteratorsWalkBothWays) {
+  small_list my_list{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  int expected = 10;
+  auto it = my_list.end();
+  do {
+    --it;
+    EXPECT_EQ(*it, expected--);
+  } while (it != my_list.begin());
+  EXPECT_EQ(expected, 0);
+  EXPECT_EQ(my_list[0], 1);
+  EXPECT_EQ(my_list[9], 10);
+  my_list[5] = 60;
+  EXPECT_EQ(my_list[5], 60);
+}
+
+TEST(unrolled_list, SpliceKeepsMovedIterators) {
+  small_list my_list{1, 2, 3, 4, 5, 6};
+  small_list other{10, 11, 12, 13, 14};
+  auto moved = ++other.begin();
+  auto pos = my_list.begin();
+  ++pos;
+  ++pos;
+  my_list.splice(pos, other);
+  expectSameContents(my_list,
+                     std::list<int>{1, 2, 10, 11, 12, 13, 14, 3, 4, 5, 6});
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(*moved, 11);
+  *moved = 42;
+  EXPECT_EQ(my_list[3], 42);
+
+  small_list tail{7, 8};
+  my_list.splice(my_list.end(), tail);
+  EXPECT_EQ(my_list.back(), 8);
+  small_list head{0};
+  my_list.splice(my_list.begin(), head);
+  EXPECT_EQ(my_list.front(), 0);
+  EXPECT_EQ(my_list.size(), 14U);
+}
+
+TEST(unrolled_list, MergeIsStable) {
+  auto by_tens = [](int a, int b) { return a / 10 < b / 10; };
+  small_list my_list{10, 30, 31, 50};
+  small_list other{11, 20, 32, 60, 61};
+  my_list.merge(other, by_tens);
+  expectSameContents(my_list,
+                     std::list<int>{10, 11, 20, 30, 31, 32, 50, 60, 61});
+  EXPECT_TRUE(other.empty());
+  small_list empty;
+  empty.merge(my_list);
+  EXPECT_EQ(empty.size(), 9U);
+  EXPECT_TRUE(my_list.empty());
+}
+
+TEST(unrolled_list, MoveOnlyElements) {
+  using ptr_list = s21::unrolled_list<std::unique_ptr<int>, 4>;
+  auto less = [](const std::unique_ptr<int> &a, const std::unique_ptr<int> &b) {
+    return *a < *b;
+  };
+  ptr_list my_list;
+  ptr_list other;
+  for (int i : {7, 1, 5, 3, 9}) my_list.push_back(std::make_unique<int>(i));
+  for (int i : {2, 8, 4, 6}) other.push_back(std::make_unique<int>(i));
+  my_list.sort(less);
+  other.sort(less);
+  my_list.merge(other, less);
+  EXPECT_TRUE(other.empty());
+  std::list<int> values;
+  for (const auto &item : my_list) values.push_back(*item);
+  expectSameContents(values, std::list<int>{1, 2, 3, 4, 5, 6, 7, 8, 9});
+}
+
+TEST(unrolled_list, SortReverseUnique) {
+  small_list my_list{5, 3, 9, 1, 3, 7, 5, 2, 8, 1};
+  std::list<int> list{5, 3, 9, 1, 3, 7, 5, 2, 8, 1};
+  my_list.sort();
+  list.sort();
+  expectSameContents(my_list, list);
+  my_list.reverse();
+  list.reverse();
+  expectSameContents(my_list, list);
+  my_list.unique();
+  list.unique();
+  expectSameContents(my_list, list);
+}
+
+TEST(unrolled_list, UniqueMatchesList) {
+  s21::list<std::string> words{"a", "a", "b", "a", "c", "c", "c",
+                               "b", "d", "a", "a"};
+  s21::unrolled_list<std::string, 2> my_words{"a", "a", "b", "a", "c", "c",
+                                              "c", "b", "d", "a", "a"};
+  words.unique();
+  my_words.unique();
+  ASSERT_EQ(my_words.size(), words.size());
+  auto it = words.begin();
+  for (const auto &word : my_words) EXPECT_EQ(word, *it++);
+}
+
+TEST(unrolled_list, InsertMany) {
+  small_list my_list{1, 5};
+  my_list.insert_many(++my_list.begin(), 2, 3, 4);
+  my_list.insert_many_back(6, 7);
+  my_list.insert_many_front(0);
+  expectSameContents(my_list, std::list<int>{0, 1, 2, 3, 4, 5, 6, 7});
+}
+
+TEST(unrolled_list, SwapAndClear) {
+  small_list first{1, 2, 3, 4, 5};
+  small_list second{9};
+  first.swap(second);
+  expectSameContents(first, std::list<int>{9});
+  expectSameContents(second, std::list<int>{1, 2, 3, 4, 5});
+  second.clear();
+  EXPECT_TRUE(second.empty());
+  second.push_back(1);
+  EXPECT_EQ(second.front(), 1);
+}
+
+TEST(unrolled_list, RandomOpsMatchStdList) {
+  s21::unrolled_list<std::string, 3> my_list;
+  std::list<std::string> list;
+  unsigned state = 7;
+  for (int step = 0; step < 4000; ++step) {
+    state = state * 1103515245U + 12345U;
+    unsigned op = (state >> 16) % 6;
+    std::size_t at = list.empty() ? 0 : (state >> 8) % list.size();
+    auto my_it = my_list.begin();
+    auto it = list.begin();
+    for (std::size_t i = 0; i < at; ++i, ++my_it, ++it) {
+    }
+    std::string value = std::to_string(step);
+    if (op == 0) {
+      my_list.push_back(value);
+      list.push_back(value);
+    } else if (op == 1) {
+      my_list.push_front(value);
+      list.push_front(value);
+    } else if (op <= 3) {
+      EXPECT_EQ(*my_list.insert(my_it, value), *list.insert(it, value));
+    } else if (!list.empty()) {
+      auto my_next = my_list.erase(my_it);
+      auto next = list.erase(it);
+      ASSERT_EQ(my_next == my_list.end(), next == list.end());
+      if (next != list.end()) {
+        EXPECT_EQ(*my_next, *next);
+      }
+    }
+  }
+  expectSameContents(my_list, list);
+}
@@ -0,0 +1,540 @@
+#ifndef CPP2_S21_CONTAINERS_2_SRC_UNROLLED_LIST_S21_UNROLLED_LIST_H
+#define CPP2_S21_CONTAINERS_2_SRC_UNROLLED_LIST_S21_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Doubly linked list of fixed-capacity chunks, each holding up to ChunkSize
+// elements side by side. Scans touch one cache line per few elements instead
+// of one per element, and small T pays three words per chunk rather than two
+// per element.
+//
+// Iterators are (chunk, index) pairs. insert() and erase() invalidate the
+// iterators into the chunk they touch (erase() also those into the chunk
+// after it); iterators into other chunks stay valid. splice() keeps
+// iterators to the moved elements valid. merge(), sort(), unique() and
+// reverse() move elements around and invalidate every iterator.
+template <typename T,
+          std::size_t ChunkSize = (sizeof(T) < 64 ? 256 / sizeof(T) : 4)>
+class unrolled_list {
+  static_assert(ChunkSize >= 2, "a chunk must hold at least two elements");
+
+ public:
+  class UnrolledListIterator;
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = UnrolledListIterator;
+  using const_iterator = const UnrolledListIterator;
+  using size_type = size_t;
+
+  unrolled_list() : size_(0U) {}
+
+  explicit unrolled_list(size_type n) : size_(0U) {
+    for (size_type i = 0; i < n; ++i) push_back(value_type());
+  }
+
+  unrolled_list(std::initializer_list<value_type> const &items) : size_(0U) {
+    for (const auto &item : items) push_back(item);
+  }
+
+  unrolled_list(const unrolled_list &other) : size_(0U) {
+    for (const auto &item : other) push_back(item);
+  }
+
+  unrolled_list(unrolled_list &&other) noexcept : size_(0U) {
+    takeChunks(other);
+  }
+
+  ~unrolled_list() { clear(); }
+
+  unrolled_list &operator=(const unrolled_list &other) {
+    if (this != &other) {
+      clear();
+      for (const auto &item : other) push_back(item);
+    }
+    return *this;
+  }
+
+  unrolled_list &operator=(unrolled_list &&other) noexcept {
+    if (this != &other) {
+      clear();
+      takeChunks(other);
+    }
+    return *this;
+  }
+
+  unrolled_list &operator=(std::initializer_list<value_type> const &items) {
+    clear();
+    for (const auto &item : items) push_back(item);
+    return *this;
+  }
+
+  bool operator==(const unrolled_list &other) const {
+    if (size_ != other.size_) return false;
+    iterator it = other.begin();
+    for (const auto &item : *this) {
+      if (!(item == *it++)) return false;
+    }
+    return true;
+  }
+
+  bool operator!=(const unrolled_list &other) const {
+    return !(*this == other);
+  }
+
+  const_reference front() const {
+    if (size_ == 0) throw std::out_of_range("list is empty.");
+    return *chunk(fake_.next)->slot(0);
+  }
+
+  const_reference back() const {
+    if (size_ == 0) throw std::out_of_range("list is empty.");
+    return *chunk(fake_.prev)->slot(fake_.prev->count - 1);
+  }
+
+  iterator begin() { return iterator(fake_.next, 0); }
+  const_iterator begin() const { return iterator(fake_.next, 0); }
+  const_iterator cbegin() const { return begin(); }
+
+  iterator end() { return iterator(&fake_, 0); }
+  const_iterator end() const { return iterator(sentinel(), 0); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(Chunk) * ChunkSize;
+  }
+
+  void clear() {
+    ChunkBase *current = fake_.next;
+    while (current != &fake_) {
+      ChunkBase *next = current->next;
+      destroyElements(chunk(current), 0);
+      delete chunk(current);
+      current = next;
+    }
+    fake_.next = fake_.prev = &fake_;
+    size_ = 0;
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    if (pos.chunk_ == &fake_) {
+      push_back(value);
+      return iterator(fake_.prev, fake_.prev->count - 1);
+    }
+    Chunk *target = chunk(pos.chunk_);
+    size_type index = pos.index_;
+    if (target->count == ChunkSize) {
+      value_type copy(value);
+      splitAt(target, ChunkSize / 2);
+      if (index > target->count) {
+        index -= target->count;
+        target = chunk(target->next);
+      }
+      insertAt(target, index, std::move(copy));
+    } else {
+      insertAt(target, index, value);
+    }
+    ++size_;
+    return iterator(target, index);
+  }
+
+  iterator erase(iterator pos) {
+    if (size_ == 0 || pos.chunk_ == &fake_) return end();
+    Chunk *target = chunk(pos.chunk_);
+    size_type index = pos.index_;
+    eraseAt(target, index);
+    --size_;
+    if (target->count == 0) {
+      ChunkBase *next = target->next;
+      unlinkChunk(target);
+      return iterator(next, 0);
+    }
+    ChunkBase *next = target->next;
+    if (next != &fake_ && target->count < ChunkSize / 2 &&
+        target->count + next->count <= ChunkSize) {
+      absorbNext(target);
+    }
+    if (index < target->count) return iterator(target, index);
+    return iterator(target->next, 0);
+  }
+
+  void push_back(const_reference value) { append(value); }
+  void push_back(value_type &&value) { append(std::move(value)); }
+
+  void pop_back() {
+    if (size_ == 0) return;
+    Chunk *last = chunk(fake_.prev);
+    last->slot(--last->count)->~value_type();
+    if (last->count == 0) unlinkChunk(last);
+    --size_;
+  }
+
+  void push_front(const_reference value) {
+    ChunkBase *first = fake_.next;
+    if (first == &fake_ || first->count == ChunkSize) {
+      Chunk *fresh = linkChunkBefore(first);
+      constructOrUnlink(fresh, value);
+    } else {
+      insertAt(chunk(first), 0, value_type(value));
+    }
+    ++size_;
+  }
+
+  void pop_front() {
+    if (size_ == 0) return;
+    Chunk *first = chunk(fake_.next);
+    eraseAt(first, 0);
+    if (first->count == 0) unlinkChunk(first);
+    --size_;
+  }
+
+  void swap(unrolled_list &other) {
+    if (this != &other) {
+      unrolled_list tmp;
+      tmp.takeChunks(*this);
+      takeChunks(other);
+      other.takeChunks(tmp);
+    }
+  }
+
+  void merge(unrolled_list &other) { merge(other, std::less<value_type>()); }
+
+  // Stable: equal elements keep this list's ones first. The result is
+  // packed into fresh chunks.
+  template <class Compare>
+  void merge(unrolled_list &other, Compare comp) {
+    if (this == &other || other.size_ == 0) return;
+    if (size_ == 0) {
+      takeChunks(other);
+      return;
+    }
+    unrolled_list merged;
+    iterator mine = begin();
+    iterator theirs = other.begin();
+    while (mine != end() && theirs != other.end()) {
+      if (comp(*theirs, *mine)) {
+        merged.push_back(std::move(*theirs++));
+      } else {
+        merged.push_back(std::move(*mine++));
+      }
+    }
+    for (; mine != end(); ++mine) merged.push_back(std::move(*mine));
+    for (; theirs != other.end(); ++theirs) {
+      merged.push_back(std::move(*theirs));
+    }
+    clear();
+    other.clear();
+    takeChunks(merged);
+  }
+
+  // Moves other's chunks in front of pos without copying any element. The
+  // chunk under pos is split in two if pos is not its first element.
+  void splice(const_iterator pos, unrolled_list &other) {
+    if (this == &other || other.size_ == 0) return;
+    ChunkBase *at = pos.chunk_;
+    if (at != &fake_ && pos.index_ > 0) {
+      splitAt(chunk(at), pos.index_);
+      at = at->next;
+    }
+    ChunkBase *first = other.fake_.next;
+    ChunkBase *last = other.fake_.prev;
+    first->prev = at->prev;
+    at->prev->next = first;
+    last->next = at;
+    at->prev = last;
+    size_ += other.size_;
+    other.fake_.next = other.fake_.prev = &other.fake_;
+    other.size_ = 0;
+  }
+
+  void reverse() {
+    ChunkBase *current = &fake_;
+    do {
+      if (current != &fake_) {
+        Chunk *full = chunk(current);
+        std::reverse(full->slot(0), full->slot(full->count));
+      }
+      std::swap(current->next, current->prev);
+      current = current->prev;
+    } while (current != &fake_);
+  }
+
+  // Collapses runs of adjacent equal elements, like list::unique(), and
+  // packs the survivors towards the front.
+  void unique() {
+    if (size_ <= 1) return;
+    iterator write = begin();
+    iterator read = write;
+    for (++read; read != end(); ++read) {
+      if (*write == *read) continue;
+      ++write;
+      if (write != read) *write = std::move(*read);
+    }
+    truncate(++write);
+  }
+
+  void sort() { sort(std::less<value_type>()); }
+
+  // Stable sort through a contiguous buffer; the chunk layout is kept.
+  template <class Compare>
+  void sort(Compare comp) {
+    if (size_ <= 1) return;
+    s21::vector<value_type> buffer;
+    buffer.reserve(size_);
+    for (auto &item : *this) buffer.insert_many_back(std::move(item));
+    std::stable_sort(buffer.begin(), buffer.end(), comp);
+    auto source = buffer.begin();
+    for (auto &item : *this) item = std::move(*source++);
+  }
+
+  template <class... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    iterator current = pos;
+    for (auto &arg : {args...}) {
+      current = insert(current, arg);
+      ++current;
+    }
+    return current;
+  }
+
+  template <class... Args>
+  void insert_many_back(Args &&...args) {
+    for (auto &arg : {args...}) push_back(arg);
+  }
+
+  template <class... Args>
+  void insert_many_front(Args &&...args) {
+    for (auto &arg : {args...}) push_front(arg);
+  }
+
+  T &operator[](size_type index) {
+    ChunkBase *current = fake_.next;
+    while (index >= current->count) {
+      index -= current->count;
+      current = current->next;
+    }
+    return *chunk(current)->slot(index);
+  }
+
+ private:
+  struct ChunkBase {
+    ChunkBase() : next(this), prev(this), count(0) {}
+
+    ChunkBase *next;
+    ChunkBase *prev;
+    size_type count;
+  };
+
+  struct Chunk : ChunkBase {
+    value_type *slot(size_type index) {
+      return std::launder(reinterpret_cast<value_type *>(storage)) + index;
+    }
+
+    alignas(value_type) unsigned char storage[ChunkSize * sizeof(value_type)];
+  };
+
+ public:
+  class UnrolledListIterator {
+   public:
+    UnrolledListIterator() : chunk_(nullptr), index_(0) {}
+    UnrolledListIterator(ChunkBase *chunk, size_type index)
+        : chunk_(chunk), index_(index) {}
+
+    reference operator*() const {
+      return *static_cast<Chunk *>(chunk_)->slot(index_);
+    }
+
+    UnrolledListIterator &operator++() {
+      if (++index_ == chunk_->count) {
+        chunk_ = chunk_->next;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    UnrolledListIterator operator++(int) {
+      UnrolledListIterator temp = *this;
+      ++*this;
+      return temp;
+    }
+
+    UnrolledListIterator &operator--() {
+      if (index_ == 0) {
+        chunk_ = chunk_->prev;
+        index_ = chunk_->count;
+      }
+      --index_;
+      return *this;
+    }
+
+    UnrolledListIterator operator--(int) {
+      UnrolledListIterator temp = *this;
+      --*this;
+      return temp;
+    }
+
+    bool operator==(const UnrolledListIterator &other) const {
+      return chunk_ == other.chunk_ && index_ == other.index_;
+    }
+
+    bool operator!=(const UnrolledListIterator &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class unrolled_list;
+
+    ChunkBase *chunk_;
+    size_type index_;
+  };
+
+ private:
+  static Chunk *chunk(ChunkBase *base) { return static_cast<Chunk *>(base); }
+
+  ChunkBase *sentinel() const { return const_cast<ChunkBase *>(&fake_); }
+
+  static Chunk *linkChunkBefore(ChunkBase *pos) {
+    Chunk *fresh = new Chunk;
+    fresh->next = pos;
+    fresh->prev = pos->prev;
+    pos->prev->next = fresh;
+    pos->prev = fresh;
+    return fresh;
+  }
+
+  // Unlinks and frees a chunk whose elements are already destroyed.
+  static void unlinkChunk(Chunk *target) {
+    target->prev->next = target->next;
+    target->next->prev = target->prev;
+    delete target;
+  }
+
+  template <class V>
+  static void constructOrUnlink(Chunk *fresh, V &&value) {
+    try {
+      new (fresh->slot(0)) value_type(std::forward<V>(value));
+    } catch (...) {
+      unlinkChunk(fresh);
+      throw;
+    }
+    fresh->count = 1;
+  }
+
+  static void destroyElements(Chunk *target, size_type from) {
+    for (size_type i = from; i < target->count; ++i) {
+      target->slot(i)->~value_type();
+    }
+    target->count = from;
+  }
+
+  // The chunk must have room for one more element.
+  static void insertAt(Chunk *target, size_type index, value_type &&value) {
+    size_type count = target->count;
+    if (index == count) {
+      new (target->slot(count)) value_type(std::move(value));
+    } else {
+      new (target->slot(count)) value_type(std::move(*target->slot(count - 1)));
+      std::move_backward(target->slot(index), target->slot(count - 1),
+                         target->slot(count));
+      *target->slot(index) = std::move(value);
+    }
+    target->count = count + 1;
+  }
+
+  static void insertAt(Chunk *target, size_type index, const_reference value) {
+    insertAt(target, index, value_type(value));
+  }
+
+  static void eraseAt(Chunk *target, size_type index) {
+    std::move(target->slot(index + 1), target->slot(target->count),
+              target->slot(index));
+    target->slot(--target->count)->~value_type();
+  }
+
+  // Moves the elements from index on into a new chunk right after target.
+  static void splitAt(Chunk *target, size_type index) {
+    Chunk *tail = linkChunkBefore(target->next);
+    for (size_type i = index; i < target->count; ++i) {
+      new (tail->slot(i - index)) value_type(std::move(*target->slot(i)));
+      ++tail->count;
+    }
+    destroyElements(target, index);
+  }
+
+  static void absorbNext(Chunk *target) {
+    Chunk *next = chunk(target->next);
+    for (size_type i = 0; i < next->count; ++i) {
+      new (target->slot(target->count++))
+          value_type(std::move(*next->slot(i)));
+    }
+    destroyElements(next, 0);
+    unlinkChunk(next);
+  }
+
+  template <class V>
+  void append(V &&value) {
+    ChunkBase *last = fake_.prev;
+    if (last == &fake_ || last->count == ChunkSize) {
+      Chunk *fresh = linkChunkBefore(&fake_);
+      constructOrUnlink(fresh, std::forward<V>(value));
+    } else {
+      new (chunk(last)->slot(last->count)) value_type(std::forward<V>(value));
+      ++last->count;
+    }
+    ++size_;
+  }
+
+  // Drops every element from pos to the end.
+  void truncate(iterator pos) {
+    ChunkBase *current = pos.chunk_;
+    if (current == &fake_) return;
+    ChunkBase *last = current->prev;
+    if (pos.index_ > 0) {
+      size_ -= current->count - pos.index_;
+      destroyElements(chunk(current), pos.index_);
+      last = current;
+      current = current->next;
+    }
+    while (current != &fake_) {
+      ChunkBase *next = current->next;
+      size_ -= current->count;
+      destroyElements(chunk(current), 0);
+      delete chunk(current);
+      current = next;
+    }
+    last->next = &fake_;
+    fake_.prev = last;
+  }
+
+  // Moves every chunk of other into this list, which must be empty.
+  void takeChunks(unrolled_list &other) {
+    if (other.size_ == 0) return;
+    fake_.next = other.fake_.next;
+    fake_.prev = other.fake_.prev;
+    fake_.next->prev = fake_.prev->next = &fake_;
+    size_ = other.size_;
+    other.fake_.next = other.fake_.prev = &other.fake_;
+    other.size_ = 0;
+  }
+
+  size_type size_;
+  ChunkBase fake_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_2_SRC_UNROLLED_LIST_S21_UNROLLED_LIST_H
@@ -1,7 +1,65 @@
 #include <gtest/gtest.h>
 
+#include <list>
+#include <stdexcept>
+#include <string>
+
+#include "../list/s21_list.h"
 #include "s21_vector.h"
 
+namespace {
+
+// Counts live objects; has no default constructor.
+struct Counted {
+  explicit Counted(int value) : value(value) { ++live; }
+  Counted(const Counted &other) : value(other.value) { ++live; }
+  Counted &operator=(const Counted &other) = default;
+  ~Counted() { --live; }
+
+  static int live;
+  int value;
+};
+
+int Counted::live = 0;
+
+// Records how elements were carried across reallocations.
+template <bool kNothrowMove>
+struct Traced {
+  explicit Traced(int value) : value(value) {}
+  Traced(const Traced &other) : value(other.value) { ++copies; }
+  Traced(Traced &&other) noexcept(kNothrowMove) : value(other.value) {
+    ++moves;
+  }
+  Traced &operator=(const Traced &other) = default;
+
+  static int copies;
+  static int moves;
+  int value;
+};
+
+template <bool kNothrowMove>
+int Traced<kNothrowMove>::copies = 0;
+template <bool kNothrowMove>
+int Traced<kNothrowMove>::moves = 0;
+
+// Copies are its only moves, and the one numbered fail_at throws.
+struct CopyThrows {
+  explicit CopyThrows(int value) : value(value) { ++live; }
+  CopyThrows(const CopyThrows &other) : value(other.value) {
+    if (copies++ == fail_at) throw std::runtime_error("copy");
+    ++live;
+  }
+  CopyThrows &operator=(const CopyThrows &other) = default;
+  ~CopyThrows() { --live; }
+
+  static inline int copies = 0;
+  static inline int fail_at = -1;
+  static inline int live = 0;
+  int value;
+};
+
+}  // namespace
+
 TEST(vector, DefaultConstructor) {
   s21::vector<int> v;
   EXPECT_TRUE(v.empty());
@@ -411,3 +469,194 @@ TEST(vector, FunctionInsertMany2) {
   EXPECT_EQ(vec[4], 5);
   EXPECT_EQ(vec[5], 6);
 }
+
+TEST(VectorStorage, ReserveConstructsNothing) {
+  {
+    s21::vector<Counted> v;
+    v.reserve(1000);
+    EXPECT_EQ(Counted::live, 0);
+    EXPECT_EQ(v.capacity(), 1000U);
+    v.push_back(Counted(1));
+    v.push_back(Counted(2));
+    EXPECT_EQ(Counted::live, 2);
+    v.reserve(5000);
+    EXPECT_EQ(Counted::live, 2);
+    EXPECT_EQ(v[1].value, 2);
+  }
+  EXPECT_EQ(Counted::live, 0);
+}
+
+TEST(VectorStorage, RemovalDestroysElements) {
+  {
+    s21::vector<Counted> v{Counted(1), Counted(2), Counted(3), Counted(4)};
+    EXPECT_EQ(Counted::live, 4);
+    v.pop_back();
+    EXPECT_EQ(Counted::live, 3);
+    v.erase(v.begin());
+    EXPECT_EQ(Counted::live, 2);
+    EXPECT_EQ(v[0].value, 2);
+    EXPECT_EQ(v[1].value, 3);
+    v.insert(v.begin() + 1, Counted(9));
+    EXPECT_EQ(Counted::live, 3);
+    EXPECT_EQ(v[1].value, 9);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 3U);
+    EXPECT_EQ(Counted::live, 3);
+    s21::vector<Counted> copy;
+    copy = v;
+    EXPECT_EQ(Counted::live, 6);
+    v.clear();
+    EXPECT_EQ(Counted::live, 3);
+  }
+  EXPECT_EQ(Counted::live, 0);
+}
+
+TEST(VectorStorage, SelfReferencingInsert) {
+  s21::vector<std::string> v{"a", "b"};
+  v.shrink_to_fit();
+  v.push_back(v[0]);
+  v.insert(v.begin(), v[2]);
+  ASSERT_EQ(v.size(), 4U);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[3], "a");
+}
+
+TEST(VectorGrowth, MovesWhenMoveCannotThrow) {
+  using Item = Traced<true>;
+  s21::vector<Item> v;
+  Item item(7);
+  for (int i = 0; i < 100; ++i) v.push_back(item);
+  EXPECT_EQ(Item::copies, 100);
+  EXPECT_GT(Item::moves, 0);
+  Item::moves = 0;
+  v.reserve(1000);
+  EXPECT_EQ(Item::moves, 100);
+  EXPECT_EQ(Item::copies, 100);
+  EXPECT_EQ(v[99].value, 7);
+}
+
+TEST(VectorGrowth, CopiesWhenMoveMayThrow) {
+  using Item = Traced<false>;
+  s21::vector<Item> v;
+  Item item(7);
+  for (int i = 0; i < 100; ++i) v.push_back(item);
+  EXPECT_EQ(Item::moves, 0);
+  Item::copies = 0;
+  v.reserve(1000);
+  EXPECT_EQ(Item::copies, 100);
+  EXPECT_EQ(Item::moves, 0);
+}
+
+TEST(VectorGrowth, TriviallyCopyableSurvivesGrowth) {
+  struct Point {
+    int x;
+    double y;
+  };
+  s21::vector<Point> v;
+  for (int i = 0; i < 1000; ++i) v.push_back(Point{i, i * 0.5});
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 1000U);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(v[i].x, i);
+    EXPECT_EQ(v[i].y, i * 0.5);
+  }
+}
+
+TEST(VectorRangeInsert, CountInsert) {
+  s21::vector<int> v{1, 5};
+  auto it = v.insert(v.begin() + 1, 3, 7);
+  EXPECT_EQ(it - v.begin(), 1);
+  s21::vector<int> expected{1, 7, 7, 7, 5};
+  ASSERT_EQ(v.size(), expected.size());
+  for (std::size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+  it = v.insert(v.end(), 0, 9);
+  EXPECT_TRUE(it == v.end());
+  EXPECT_EQ(v.size(), 5U);
+  v.insert(v.begin(), 2, v[4]);
+  EXPECT_EQ(v[0], 5);
+  EXPECT_EQ(v[1], 5);
+  EXPECT_EQ(v[2], 1);
+}
+
+TEST(VectorRangeInsert, RangeFromOtherContainers) {
+  s21::vector<std::string> v{"a", "e"};
+  std::list<std::string> middle{"b", "c", "d"};
+  auto it = v.insert(v.begin() + 1, middle.begin(), middle.end());
+  EXPECT_EQ(*it, "b");
+  s21::list<std::string> tail{"f", "g"};
+  v.insert(v.end(), tail.begin(), tail.end());
+  const char *head[] = {"x", "y"};
+  v.insert(v.begin(), head, head + 2);
+  std::string expected[] = {"x", "y", "a", "b", "c", "d", "e", "f", "g"};
+  ASSERT_EQ(v.size(), 9U);
+  for (std::size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(VectorRangeInsert, InsertManyMovesAndKeepsOrder) {
+  s21::vector<std::string> v{"a", "d"};
+  v.reserve(10);
+  std::string moved = "c";
+  auto it = v.insert_many(v.cbegin() + 1, "b", std::move(moved), v[0]);
+  EXPECT_EQ(it - v.begin(), 4);
+  v.insert_many_back(std::string(20, 'z'));
+  std::string expected[] = {"a", "b", "c", "a", "d", std::string(20, 'z')};
+  ASSERT_EQ(v.size(), 6U);
+  for (std::size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(VectorRangeInsert, GrowsOnceForTheWholeRange) {
+  using Item = Traced<true>;
+  s21::vector<Item> v;
+  Item item(1);
+  for (int i = 0; i < 64; ++i) v.push_back(item);
+  s21::vector<Item> extra;
+  for (int i = 0; i < 100; ++i) extra.push_back(Item(2));
+  Item::copies = 0;
+  Item::moves = 0;
+  v.insert(v.begin() + 32, extra.begin(), extra.end());
+  EXPECT_EQ(Item::copies, 100);
+  EXPECT_EQ(Item::moves, 64);
+  EXPECT_EQ(v.size(), 164U);
+  EXPECT_EQ(v[31].value, 1);
+  EXPECT_EQ(v[32].value, 2);
+  EXPECT_EQ(v[131].value, 2);
+  EXPECT_EQ(v[132].value, 1);
+}
+
+TEST(VectorRangeInsert, ThrowingElementLeavesVectorUnchanged) {
+  struct Fragile {
+    explicit Fragile(int value) : value(value) {
+      if (value < 0) throw std::runtime_error("negative");
+    }
+    int value;
+  };
+  s21::vector<Fragile> v{Fragile(1), Fragile(2), Fragile(3)};
+  v.reserve(10);
+  EXPECT_THROW(v.insert_many(v.cbegin() + 1, 7, -1), std::runtime_error);
+  ASSERT_EQ(v.size(), 3U);
+  EXPECT_EQ(v[0].value, 1);
+  EXPECT_EQ(v[1].value, 2);
+  EXPECT_EQ(v[2].value, 3);
+}
+
+TEST(VectorRangeInsert, ThrowingShiftLeavesVectorUnchanged) {
+  {
+    s21::vector<CopyThrows> v;
+    v.reserve(10);
+    for (int i = 0; i < 5; ++i) v.push_back(CopyThrows(i));
+    CopyThrows nine(9);
+    CopyThrows::copies = 0;
+    CopyThrows::fail_at = 3;  // the first copy that shifts the tail
+    EXPECT_THROW(v.insert(v.cbegin() + 1, 2, nine), std::runtime_error);
+    CopyThrows::fail_at = -1;
+    ASSERT_EQ(v.size(), 5U);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i].value, i);
+    EXPECT_EQ(CopyThrows::live, 6);
+
+    v.insert(v.cbegin() + 1, 2, nine);
+    ASSERT_EQ(v.size(), 7U);
+    EXPECT_EQ(v[2].value, 9);
+    EXPECT_EQ(v[3].value, 1);
+  }
+  EXPECT_EQ(CopyThrows::live, 0);
+}
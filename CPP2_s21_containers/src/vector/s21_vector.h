@@ -1,16 +1,33 @@
 #ifndef CPP2_S21_CONTAINERS_2_SRC_VECTOR_VECTOR_H
 #define CPP2_S21_CONTAINERS_2_SRC_VECTOR_VECTOR_H
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <initializer_list>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "../allocator/s21_allocator_propagation.h"
+
 namespace s21 {
-template <typename T>
+template <typename T, std::size_t N>
+class small_vector;
+template <typename... Fields>
+class soa_vector;
+
+// Elements live in raw storage from Allocator and are constructed and
+// destroyed one by one, so capacity beyond size() holds no objects and T
+// needs no default constructor unless vector(n) is used.
+template <typename T, typename Allocator = std::allocator<T>>
 class vector {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using iterator = T *;
@@ -18,14 +35,21 @@ class vector {
   using size_type = size_t;
 
   vector();
-  explicit vector(size_type n);
-  vector(std::initializer_list<value_type> const &items);
+  explicit vector(const Allocator &alloc);
+  explicit vector(size_type n, const Allocator &alloc = Allocator());
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc = Allocator());
   vector(const vector &v);
   vector(vector &&v) noexcept;
   ~vector();
 
-  vector<T> &operator=(const vector &v);
-  vector<T> &operator=(vector &&v) noexcept;
+  vector &operator=(const vector &v);
+  vector &operator=(vector &&v) noexcept(
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value ||
+      std::allocator_traits<Allocator>::is_always_equal::value);
+
+  allocator_type get_allocator() const { return alloc_; }
 
   reference at(size_type pos);
   const_reference at(size_type pos) const;
@@ -52,6 +76,11 @@ class vector {
 
   void clear();
   iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  // [first, last) must be a multi-pass range outside this vector.
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
   iterator erase(const_iterator pos);
   void push_back(const_reference value);
   void pop_back();
@@ -63,270 +92,496 @@ class vector {
   void insert_many_back(Args &&...args);
 
  private:
+  // Hands heap buffers over and shares relocate().
+  template <typename U, std::size_t N>
+  friend class small_vector;
+  // Shares relocate() for its columns.
+  template <typename... Fields>
+  friend class soa_vector;
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  value_type *allocate(size_type n);
+  void deallocate(value_type *storage, size_type n);
+  void destroyElements();
+  static void relocate(value_type *first, size_type count,
+                       value_type *dest);
+  void adopt(value_type *storage, size_type n);
+  void reallocate(size_type n);
+  template <typename Construct>
+  iterator insertGap(size_type index, size_type count, Construct construct);
+
+  Allocator alloc_;
   size_t size_ = 0;
   size_t capacity_ = 0;
   value_type *vector_ = nullptr;
-
- private:
 };
 
-template <typename T>
-vector<T>::vector() : size_(0U), capacity_(0U), vector_(nullptr) {}
-
-template <typename T>
-vector<T>::vector(size_type n)
-    : size_(n), capacity_(n), vector_(n ? new value_type[n] : nullptr) {}
-
-template <class T>
-vector<T>::vector(std::initializer_list<value_type> const &items) {
-  vector_ = new value_type[items.size()];
-  int i = 0;
-  for (auto it = items.begin(); it != items.end(); it++) {
-    vector_[i] = *it;
-    i++;
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector() : size_(0U), capacity_(0U), vector_(nullptr) {}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const Allocator &alloc)
+    : alloc_(alloc), size_(0U), capacity_(0U), vector_(nullptr) {}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(size_type n, const Allocator &alloc)
+    : alloc_(alloc), size_(0U), capacity_(n), vector_(allocate(n)) {
+  try {
+    std::uninitialized_value_construct_n(vector_, n);
+  } catch (...) {
+    deallocate(vector_, n);
+    throw;
+  }
+  size_ = n;
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(std::initializer_list<value_type> const &items,
+                             const Allocator &alloc)
+    : alloc_(alloc),
+      size_(0U),
+      capacity_(items.size()),
+      vector_(allocate(items.size())) {
+  try {
+    std::uninitialized_copy(items.begin(), items.end(), vector_);
+  } catch (...) {
+    deallocate(vector_, capacity_);
+    throw;
   }
   size_ = items.size();
-  capacity_ = items.size();
 }
 
-template <typename T>
-vector<T>::vector(const vector &v) : vector(v.size()) {
-  //  size_ = v.size_;
-  //  capacity_ = v.capacity_;
-  std::copy(v.cbegin(), v.cend(), begin());
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const vector &v)
+    : alloc_(alloc_traits::select_on_container_copy_construction(v.alloc_)),
+      size_(0U),
+      capacity_(v.size_),
+      vector_(allocate(v.size_)) {
+  try {
+    std::uninitialized_copy(v.cbegin(), v.cend(), vector_);
+  } catch (...) {
+    deallocate(vector_, capacity_);
+    throw;
+  }
+  size_ = v.size_;
 }
 
-template <typename T>
-vector<T>::vector(vector &&v) noexcept {
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(vector &&v) noexcept
+    : alloc_(std::move(v.alloc_)) {
   size_ = std::exchange(v.size_, 0);
   capacity_ = std::exchange(v.capacity_, 0);
   vector_ = std::exchange(v.vector_, nullptr);
 }
 
-template <typename T>
-vector<T>::~vector() {
-  delete[] vector_;
-  vector_ = nullptr;
-  size_ = 0;
-  capacity_ = 0;
+template <typename T, typename Allocator>
+vector<T, Allocator>::~vector() {
+  clear();
 }
 
-template <typename T>
-vector<T> &vector<T>::operator=(const vector &v) {
+template <typename T, typename Allocator>
+vector<T, Allocator> &vector<T, Allocator>::operator=(const vector &v) {
   if (this != &v) {
-    delete[] vector_;
-    size_ = 0;
-    capacity_ = 0;
-    size_ = v.size_;
-    capacity_ = v.capacity_;
-    vector_ = v.vector_ ? new T[v.size_] : nullptr;
+    destroyElements();
+    if (!allocatorsEqual(alloc_, v.alloc_) &&
+        alloc_traits::propagate_on_container_copy_assignment::value) {
+      // The buffer must go back to the allocator it came from.
+      clear();
+    }
+    propagateOnCopyAssign(alloc_, v.alloc_);
+    if (capacity_ < v.size_) {
+      value_type *storage = allocate(v.size_);
+      deallocate(vector_, capacity_);
+      vector_ = storage;
+      capacity_ = v.size_;
+    }
+    std::uninitialized_copy(v.cbegin(), v.cend(), vector_);
     size_ = v.size_;
-    capacity_ = v.capacity_;
-    std::copy(v.cbegin(), v.cend(), begin());
   }
   return *this;
 }
 
-template <typename T>
-vector<T> &vector<T>::operator=(vector &&v) noexcept {
+// Takes v's buffer when the allocators allow it; otherwise moves the
+// elements one by one into memory from this vector's own allocator.
+template <typename T, typename Allocator>
+vector<T, Allocator> &vector<T, Allocator>::operator=(vector &&v) noexcept(
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
   if (this != &v) {
-    delete[] vector_;
-    size_ = v.size_;
-    capacity_ = v.capacity_;
-    vector_ = v.vector_;
-    v.size_ = 0;
-    v.capacity_ = 0;
-    v.vector_ = nullptr;
+    if (canStealOnMoveAssign(alloc_, v.alloc_)) {
+      clear();
+      propagateOnMoveAssign(alloc_, v.alloc_);
+      size_ = std::exchange(v.size_, 0);
+      capacity_ = std::exchange(v.capacity_, 0);
+      vector_ = std::exchange(v.vector_, nullptr);
+    } else {
+      destroyElements();
+      reserve(v.size_);
+      std::uninitialized_move(v.begin(), v.end(), vector_);
+      size_ = v.size_;
+      v.clear();
+    }
   }
   return *this;
 }
 
-template <typename T>
-typename vector<T>::reference vector<T>::at(size_type pos) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::reference vector<T, Allocator>::at(
+    size_type pos) {
   if (pos >= size_) {
     throw std::out_of_range("Out of range");
   }
   return vector_[pos];
 }
 
-template <typename T>
-typename vector<T>::const_reference vector<T>::at(size_type pos) const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference vector<T, Allocator>::at(
+    size_type pos) const {
   if (pos >= size_) {
     throw std::exception();
   }
   return vector_[pos];
 }
 
-template <typename T>
-typename vector<T>::reference vector<T>::operator[](size_type pos) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::reference vector<T, Allocator>::operator[](
+    size_type pos) {
   return vector_[pos];
 }
 
-template <typename T>
-typename vector<T>::const_reference vector<T>::operator[](size_type pos) const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference vector<T, Allocator>::operator[](
+    size_type pos) const {
   return vector_[pos];
 }
 
-template <typename T>
-typename vector<T>::reference vector<T>::front() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::reference vector<T, Allocator>::front() {
   return vector_[0];
 }
 
-template <typename T>
-typename vector<T>::const_reference vector<T>::front() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference vector<T, Allocator>::front()
+    const {
   return vector_[0];
 }
 
-template <typename T>
-typename vector<T>::reference vector<T>::back() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::reference vector<T, Allocator>::back() {
   return vector_[size_ - 1];
 }
 
-template <typename T>
-typename vector<T>::const_reference vector<T>::back() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference vector<T, Allocator>::back()
+    const {
   return vector_[size_ - 1];
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::data() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::data() {
   return vector_;
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::begin() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator vector<T, Allocator>::data()
+    const {
   return vector_;
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::cbegin() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::begin() {
   return vector_;
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::end() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::cbegin() const {
+  return vector_;
+}
+
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::end() {
   return vector_ + size_;
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::cend() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::cend() const {
   return vector_ + size_;
 }
 
-template <typename T>
-bool vector<T>::empty() const {
+template <typename T, typename Allocator>
+bool vector<T, Allocator>::empty() const {
   return size_ == 0;
 }
 
-template <typename T>
-typename vector<T>::size_type vector<T>::size() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::size() const {
   return size_;
 }
 
-template <typename T>
-typename vector<T>::size_type vector<T>::max_size() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::max_size()
+    const {
   return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
 }
 
-template <typename T>
-void vector<T>::reserve(size_type size) {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::reserve(size_type size) {
   if (size > max_size()) {
     throw std::exception();
   }
-  if (size >= capacity_) {
-    iterator temp = new value_type[size];
-    std::copy(begin(), end(), temp);
-    if (vector_ != nullptr) delete[] vector_;
-    vector_ = temp;
-    capacity_ = size;
-  }
+  if (size > capacity_) reallocate(size);
 }
 
-template <typename T>
-typename vector<T>::size_type vector<T>::capacity() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::capacity()
+    const {
   return capacity_;
 }
 
-template <typename T>
-void vector<T>::shrink_to_fit() {
-  if (capacity_ > size_) {
-    capacity_ = size_;
-    value_type *tmp = vector_;
-    vector_ = new value_type[capacity_];
-    for (size_t i = 0; i < size_; i++) {
-      vector_[i] = tmp[i];
-    }
-    delete[] tmp;
-  }
+template <typename T, typename Allocator>
+void vector<T, Allocator>::shrink_to_fit() {
+  if (capacity_ > size_) reallocate(size_);
 }
 
-template <typename T>
-void vector<T>::clear() {
-  size_ = 0;
+// Releases the storage as well, so capacity() is 0 afterwards.
+template <typename T, typename Allocator>
+void vector<T, Allocator>::clear() {
+  destroyElements();
+  deallocate(vector_, capacity_);
+  vector_ = nullptr;
   capacity_ = 0;
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::insert(const_iterator pos,
-                                               const_reference value) {
-  const size_type index = pos - cbegin();
-  if (size_ == capacity_) {
-    reserve(capacity_ ? capacity_ * 2 : 1);
-  }
-
-  std::copy(begin() + index, end(), vector_ + index + 1);
-  vector_[index] = value;
-  size_++;
-  return begin() + index;
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+    const_iterator pos, const_reference value) {
+  // Copied first: value may be one of the elements about to shift.
+  value_type copy(value);
+  return insertGap(pos - cbegin(), 1, [&copy](value_type *dest) {
+    new (dest) value_type(std::move(copy));
+  });
+}
+
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+    const_iterator pos, size_type count, const_reference value) {
+  value_type copy(value);
+  return insertGap(pos - cbegin(), count, [&](value_type *dest) {
+    std::uninitialized_fill_n(dest, count, copy);
+  });
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
+  size_type count = 0;
+  for (InputIt it = first; it != last; ++it) ++count;
+  return insertGap(pos - cbegin(), count, [&](value_type *dest) {
+    value_type *slot = dest;
+    try {
+      for (InputIt it = first; it != last; ++it, ++slot) {
+        new (slot) value_type(*it);
+      }
+    } catch (...) {
+      std::destroy(dest, slot);
+      throw;
+    }
+  });
 }
 
-template <typename T>
-typename vector<T>::iterator vector<T>::erase(const_iterator pos) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(
+    const_iterator pos) {
   const size_type index = pos - begin();
   std::move(begin() + index + 1, end(), vector_ + index);
-  --size_;
+  pop_back();
   return begin() + index;
 }
 
-template <typename T>
-void vector<T>::push_back(const_reference value) {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::push_back(const_reference value) {
   if (size_ == capacity_) {
-    reserve(capacity_ ? capacity_ * 2 : 1);
+    insertGap(size_, 1, [&value](value_type *dest) {
+      new (dest) value_type(value);
+    });
+  } else {
+    new (vector_ + size_) value_type(value);
+    ++size_;
   }
-  ++size_;
-  vector_[size_ - 1] = value;
 }
 
-template <typename T>
-void vector<T>::pop_back() {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::pop_back() {
   if (size_ != 0) {
     --size_;
+    vector_[size_].~value_type();
   }
 }
 
-template <typename T>
-void vector<T>::swap(vector &other) {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::swap(vector &other) {
+  propagateOnSwap(alloc_, other.alloc_);
   std::swap(vector_, other.vector_);
   std::swap(size_, other.size_);
   std::swap(capacity_, other.capacity_);
 }
 
-template <typename value_type>
+template <typename T, typename Allocator>
+T *vector<T, Allocator>::allocate(size_type n) {
+  return n ? alloc_traits::allocate(alloc_, n) : nullptr;
+}
+
+template <typename T, typename Allocator>
+void vector<T, Allocator>::deallocate(value_type *storage, size_type n) {
+  if (storage != nullptr) alloc_traits::deallocate(alloc_, storage, n);
+}
+
+template <typename T, typename Allocator>
+void vector<T, Allocator>::destroyElements() {
+  std::destroy_n(vector_, size_);
+  size_ = 0;
+}
+
+// Builds count elements at dest from those at first: a memcpy for trivially
+// copyable types, moves when they cannot throw (or T cannot be copied),
+// copies otherwise so a throwing move leaves the source intact. On failure
+// nothing is left constructed at dest.
+template <typename T, typename Allocator>
+void vector<T, Allocator>::relocate(value_type *first, size_type count,
+                         value_type *dest) {
+  if constexpr (std::is_trivially_copyable_v<value_type>) {
+    if (count != 0) std::memcpy(dest, first, count * sizeof(value_type));
+  } else if constexpr (std::is_nothrow_move_constructible_v<value_type> ||
+                       !std::is_copy_constructible_v<value_type>) {
+    std::uninitialized_move(first, first + count, dest);
+  } else {
+    std::uninitialized_copy(first, first + count, dest);
+  }
+}
+
+// Drops the old buffer, whose elements have been relocated, for storage.
+template <typename T, typename Allocator>
+void vector<T, Allocator>::adopt(value_type *storage, size_type n) {
+  std::destroy_n(vector_, size_);
+  deallocate(vector_, capacity_);
+  vector_ = storage;
+  capacity_ = n;
+}
+
+// Relocates the elements into fresh storage of n slots; n must be >= size_.
+template <typename T, typename Allocator>
+void vector<T, Allocator>::reallocate(size_type n) {
+  value_type *storage = allocate(n);
+  try {
+    relocate(vector_, size_, storage);
+  } catch (...) {
+    deallocate(storage, n);
+    throw;
+  }
+  adopt(storage, n);
+}
+
+// Opens count slots at index with at most one reallocation and one shift of
+// the tail; construct(dest) must build the count new elements at dest and
+// leave none behind if it throws, in which case the vector is unchanged.
+// Types whose moves may throw are never shifted in place, since a throw
+// halfway through would leave the tail scrambled: unless the gap is at the
+// end, they are relocated into fresh storage as if the vector were full.
+template <typename T, typename Allocator>
+template <typename Construct>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insertGap(
+    size_type index, size_type count, Construct construct) {
+  constexpr bool kShiftInPlace =
+      std::is_trivially_copyable_v<value_type> ||
+      (std::is_nothrow_move_constructible_v<value_type> &&
+       std::is_nothrow_move_assignable_v<value_type>);
+  if (count == 0) return begin() + index;
+  if (count > capacity_ - size_ || (!kShiftInPlace && index != size_)) {
+    if (count > max_size() - size_) throw std::exception();
+    size_type n = capacity_;
+    if (count > capacity_ - size_) {
+      n = std::max(capacity_ * 2, size_ + count);
+      if (n > max_size()) n = max_size();
+    }
+    value_type *storage = allocate(n);
+    try {
+      construct(storage + index);
+    } catch (...) {
+      deallocate(storage, n);
+      throw;
+    }
+    try {
+      relocate(vector_, index, storage);
+    } catch (...) {
+      std::destroy_n(storage + index, count);
+      deallocate(storage, n);
+      throw;
+    }
+    try {
+      relocate(vector_ + index, size_ - index, storage + index + count);
+    } catch (...) {
+      std::destroy_n(storage, index + count);
+      deallocate(storage, n);
+      throw;
+    }
+    adopt(storage, n);
+  } else if constexpr (std::is_trivially_copyable_v<value_type>) {
+    value_type *gap = vector_ + index;
+    std::size_t tail = (size_ - index) * sizeof(value_type);
+    std::memmove(gap + count, gap, tail);
+    try {
+      construct(gap);
+    } catch (...) {
+      std::memmove(gap, gap + count, tail);
+      throw;
+    }
+  } else {
+    // Built past the end, then rotated into place, so arguments that refer
+    // to elements of this vector are read before anything moves.
+    construct(vector_ + size_);
+    std::rotate(vector_ + index, vector_ + size_, vector_ + size_ + count);
+  }
+  size_ += count;
+  return begin() + index;
+}
+
+template <typename T, typename Allocator>
 template <typename... Args>
-typename vector<value_type>::iterator vector<value_type>::insert_many(
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert_many(
     const_iterator pos, Args &&...args) {
-  vector<value_type> temp{args...};
-  iterator it = begin() + (pos - cbegin());
-  for (size_t i = 0; i < temp.size(); ++i) {
-    it = insert(it, temp[i]);
-    ++it;
+  constexpr size_type count = sizeof...(Args);
+  const size_type index = pos - cbegin();
+  if constexpr (count == 0) {
+    return begin() + index;
+  } else if constexpr (std::is_trivially_copyable_v<value_type>) {
+    // Materialized first: the memmove fast path shifts before constructing.
+    const value_type items[] = {value_type(std::forward<Args>(args))...};
+    return insertGap(index, count, [&items](value_type *dest) {
+             std::memcpy(dest, items, sizeof(items));
+           }) +
+           count;
+  } else {
+    return insertGap(index, count, [&](value_type *dest) {
+             value_type *slot = dest;
+             try {
+               ((new (slot) value_type(std::forward<Args>(args)), ++slot),
+                ...);
+             } catch (...) {
+               std::destroy(dest, slot);
+               throw;
+             }
+           }) +
+           count;
   }
-  return it;
 }
 
-template <typename value_type>
+template <typename T, typename Allocator>
 template <typename... Args>
-void vector<value_type>::insert_many_back(Args &&...args) {
-  insert_many(end(), args...);
+void vector<T, Allocator>::insert_many_back(Args &&...args) {
+  insert_many(cend(), std::forward<Args>(args)...);
 }
 
 }  // namespace s21